@@ -2,7 +2,7 @@
  * \file
  * \brief BIND_LOW_LEVEL_INITIALIZER() macro
  *
- * \author Copyright (C) 2018-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,7 @@
  * of multiple low-level initializers with the same \a priority, the execution order within that group is unspecified.
  *
  * Values of \a priority used internally by distortos:
+ * - 0 - heap low-level initialization (only when DISTORTOS_TLSF_HEAP_ENABLE is enabled),
  * - 10 - main() thread and scheduler low-level initialization,
  * - 20 - idle thread low-level initialization,
  * - 30 - architecture low-level initialization,
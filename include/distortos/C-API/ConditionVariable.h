@@ -2,7 +2,7 @@
  * \file
  * \brief Header of C-API for distortos::ConditionVariable
  *
- * \author Copyright (C) 2017-2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -45,6 +45,9 @@ struct distortos_ConditionVariable
 {
 	/** ThreadControlBlock objects blocked on this condition variable */
 	struct estd_IntrusiveList blockedList;
+
+	/** pointer to mutex used by all threads blocked on this condition variable, NULL if different mutexes are used */
+	struct distortos_Mutex* mutex;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -59,7 +62,7 @@ struct distortos_ConditionVariable
  * \param [in] self is an equivalent of `this` hidden argument
  */
 
-#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList)}
+#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), NULL}
 
 /**
  * \brief C-API equivalent of distortos::ConditionVariable's constructor
@@ -2,7 +2,7 @@
  * \file
  * \brief Header of C-API for distortos::Semaphore
  *
- * \author Copyright (C) 2017-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "estd/C-API/IntrusiveList.h"
 
+#include "distortos/distortosConfiguration.h"
+
 #include <limits.h>
 #include <stdint.h>
 
@@ -44,6 +46,13 @@ struct distortos_Semaphore
 	/** ThreadControlBlock objects blocked on this semaphore */
 	struct estd_IntrusiveList blockedList;
 
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+	/** nodes of threads waiting for this semaphore in waitForAny() */
+	struct estd_IntrusiveList waitForAnyList;
+
+#endif	/* DISTORTOS_WAIT_FOR_ANY_ENABLE == 1 */
+
 	/** internal value of the semaphore */
 	unsigned int value;
 
@@ -66,9 +75,19 @@ struct distortos_Semaphore
  * \param [in] maxValue is the max value of the semaphore before post() returns EOVERFLOW
  */
 
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
+		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), ESTD_INTRUSIVELIST_INITIALIZER((self).waitForAnyList), \
+		(value) < (maxValue) ? (value) : (maxValue), (maxValue)}
+
+#else	/* DISTORTOS_WAIT_FOR_ANY_ENABLE != 1 */
+
 #define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
 		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
 
+#endif	/* DISTORTOS_WAIT_FOR_ANY_ENABLE != 1 */
+
 /**
  * \brief C-API equivalent of distortos::Semaphore's constructor
  *
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -45,7 +45,8 @@ public:
 	 */
 
 	constexpr ConditionVariable() :
-			blockedList_{}
+			blockedList_{},
+			mutex_{}
 	{
 
 	}
@@ -75,6 +76,11 @@ public:
 	 *
 	 * Unblocks all threads waiting on this condition variable. The notifying thread does not need to hold the same
 	 * mutex as the one held by the waiting thread(s).
+	 *
+	 * If the notifying thread holds the mutex used by all waiting threads (and this mutex doesn't use priority
+	 * inheritance or priority protect protocol), the waiting threads are moved directly to this mutex ("wait
+	 * morphing"). Each of them is unblocked only once - when the ownership of the mutex is transferred to it - instead
+	 * of being woken only to block on the mutex again.
 	 */
 
 	void notifyAll();
@@ -302,8 +308,39 @@ public:
 
 private:
 
+	/**
+	 * \brief Prepares current thread for blocking on this condition variable.
+	 *
+	 * Updates the pointer to mutex used by all waiting threads.
+	 *
+	 * \attention This function must be called with masked interrupts, after \a mutex was unlocked.
+	 *
+	 * \param [in] mutex is a reference to mutex which was unlocked by current thread
+	 *
+	 * \return true if \a mutex was released by current thread, false if current thread still owns it (possible only
+	 * for recursive mutex which was locked several times)
+	 */
+
+	bool beforeBlock(Mutex& mutex);
+
+	/**
+	 * \brief Checks whether ownership of mutex was transferred to current thread after "wait morphing" in notifyAll().
+	 *
+	 * \attention This function must be called with masked interrupts.
+	 *
+	 * \param [in] mutex is a reference to mutex used by current thread
+	 * \param [in] released is the value returned by beforeBlock()
+	 *
+	 * \return true if current thread already owns \a mutex and must not lock it again, false otherwise
+	 */
+
+	static bool isLockTransferred(const Mutex& mutex, bool released);
+
 	/// ThreadControlBlock objects blocked on this condition variable
 	internal::ThreadList blockedList_;
+
+	/// pointer to mutex used by all threads blocked on this condition variable, nullptr if different mutexes are used
+	Mutex* mutex_;
 };
 
 template<typename Predicate>
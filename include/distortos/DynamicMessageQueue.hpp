@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -23,11 +23,13 @@ namespace distortos
  * \brief DynamicMessageQueue class is a variant of MessageQueue that has dynamic storage for queue's contents.
  *
  * \tparam T is the type of data in queue
+ * \tparam UsePriorityBuckets selects whether pushing to the queue takes constant time (true) or linear time (false),
+ * see internal::MessageQueueBase::PriorityBuckets for details, default - false
  *
  * \ingroup queues
  */
 
-template<typename T>
+template<typename T, bool UsePriorityBuckets = {}>
 class DynamicMessageQueue : public MessageQueue<T>
 {
 public:
@@ -35,6 +37,9 @@ public:
 	/// import EntryStorage type from base class
 	using typename MessageQueue<T>::EntryStorage;
 
+	/// import PriorityBuckets type from base class
+	using typename MessageQueue<T>::PriorityBuckets;
+
 	/// import ValueStorage type from base class
 	using typename MessageQueue<T>::ValueStorage;
 
@@ -47,10 +52,12 @@ public:
 	explicit DynamicMessageQueue(size_t queueSize);
 };
 
-template<typename T>
-DynamicMessageQueue<T>::DynamicMessageQueue(const size_t queueSize) :
+template<typename T, bool UsePriorityBuckets>
+DynamicMessageQueue<T, UsePriorityBuckets>::DynamicMessageQueue(const size_t queueSize) :
 		MessageQueue<T>{{new EntryStorage[queueSize], internal::storageDeleter<EntryStorage>},
-				{new ValueStorage[queueSize], internal::storageDeleter<ValueStorage>}, queueSize}
+				{new ValueStorage[queueSize], internal::storageDeleter<ValueStorage>}, queueSize,
+				{UsePriorityBuckets == true ? new PriorityBuckets[1] : nullptr,
+				internal::storageDeleter<PriorityBuckets>}}
 {
 
 }
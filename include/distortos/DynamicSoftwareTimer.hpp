@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicSoftwareTimer class header
  *
- * \author Copyright (C) 2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,11 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICSOFTWARETIMER_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICSOFTWARETIMER_HPP_
 
+#include "distortos/distortosConfiguration.h"
 #include "distortos/SoftwareTimerCommon.hpp"
 
+#include "estd/InplaceFunction.hpp"
+
 #include <functional>
 
 namespace distortos
@@ -23,8 +26,10 @@ namespace distortos
 /// \{
 
 /**
- * \brief DynamicSoftwareTimer class is a type-erased interface for software timer that has dynamic storage for bound
- * function.
+ * \brief DynamicSoftwareTimer class is a type-erased interface for software timer that has storage for bound function
+ * of fixed size.
+ *
+ * Bound function (together with its arguments) must fit in DISTORTOS_BOUND_FUNCTION_STORAGE_SIZE bytes.
  */
 
 class DynamicSoftwareTimer : public SoftwareTimerCommon
@@ -55,7 +60,7 @@ private:
 	void run() override;
 
 	/// bound function object
-	std::function<void()> boundFunction_;
+	estd::InplaceFunction<void(), DISTORTOS_BOUND_FUNCTION_STORAGE_SIZE> boundFunction_;
 };
 
 /**
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThread class header
  *
- * \author Copyright (C) 2015-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -23,8 +23,10 @@ namespace distortos
 /// \{
 
 /**
- * \brief DynamicThread class is a type-erased interface for thread that has dynamic storage for bound function, stack
- * and internal DynamicSignalsReceiver object.
+ * \brief DynamicThread class is a type-erased interface for thread that has dynamic storage for stack and internal
+ * DynamicSignalsReceiver object.
+ *
+ * Bound function (together with its arguments) must fit in DISTORTOS_BOUND_FUNCTION_STORAGE_SIZE bytes.
  */
 
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
@@ -73,7 +75,7 @@ public:
 					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
 					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
-
+		detachableThread_->setStackPaintSize(parameters.stackPaintSize);
 	}
 
 	/**
@@ -123,6 +125,33 @@ public:
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \return CPU time of thread (total time during which the thread was running), core clock cycles
+	 */
+
+	uint64_t getCpuTime() const override;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \return deadline of thread, TickClock::time_point::max() if the thread doesn't use SchedulingPolicy::deadline or
+	 * its deadline was not set
+	 */
+
+	TickClock::time_point getDeadline() const override;
+
+	/**
+	 * \return number of missed deadlines of thread
+	 */
+
+	uint32_t getDeadlineMissCount() const override;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -167,11 +196,23 @@ public:
 	SchedulingPolicy getSchedulingPolicy() const override;
 
 	/**
-	 * \return "high water mark" (max usage) of thread's stack, bytes
+	 * \brief Gets "high water mark" (max usage) of thread's stack.
+	 *
+	 * If only part of the stack was painted (see setStackPaintSize()) and all of painted area was used, real usage is
+	 * unknown - in that case the size of painted area is returned, so the value equal to getStackPaintedSize() means
+	 * that real usage may be greater.
+	 *
+	 * \return "high water mark" (max usage) of thread's stack, limited to painted area, bytes
 	 */
 
 	size_t getStackHighWaterMark() const override;
 
+	/**
+	 * \return size of area of thread's stack which is painted with stack sentinel when the thread is started, bytes
+	 */
+
+	size_t getStackPaintedSize() const override;
+
 	/**
 	 * \return size of thread's stack, bytes
 	 */
@@ -228,6 +269,25 @@ public:
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \brief Sets deadline of thread which uses SchedulingPolicy::deadline.
+	 *
+	 * Threads with the same effective priority are ordered by their deadlines - thread with the earliest deadline is
+	 * placed first. Deadline is missed if the thread is still running after this time point or if it blocks after this
+	 * time point.
+	 *
+	 * \param [in] deadline is the new absolute deadline of thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread doesn't use SchedulingPolicy::deadline;
+	 */
+
+	int setDeadline(TickClock::time_point deadline) override;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -247,6 +307,21 @@ public:
 
 	void setSchedulingPolicy(SchedulingPolicy schedulingPolicy) override;
 
+	/**
+	 * \brief Sets size of area of thread's stack which is painted with stack sentinel when the thread is started.
+	 *
+	 * This operation can be performed on threads in "created" state only.
+	 *
+	 * \param [in] paintSize is the size of area of the stack which is painted with stack sentinel, values greater than
+	 * stack's size select painting of the whole stack, 0 selects painting of just the "stack guard"
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - internal thread object was detached;
+	 * - error codes returned by internal::ThreadCommon::setStackPaintSize();
+	 */
+
+	int setStackPaintSize(size_t paintSize);
+
 	/**
 	 * \brief Starts the thread.
 	 *
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadParameters class header
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -15,6 +15,7 @@
 #include "distortos/SchedulingPolicy.hpp"
 
 #include <cstddef>
+#include <cstdint>
 
 namespace distortos
 {
@@ -43,13 +44,18 @@ struct DynamicThreadParameters
 	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] stackPaintSizee is the size of area of the stack which is painted with stack sentinel when the thread
+	 * is started, values greater than \a stackSizee select painting of the whole stack, 0 selects painting of just the
+	 * "stack guard", default - SIZE_MAX
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const bool canReceiveSignalss,
 			const size_t queuedSignalss, const size_t signalActionss, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const size_t stackPaintSizee = SIZE_MAX) :
 					queuedSignals{queuedSignalss},
 					signalActions{signalActionss},
+					stackPaintSize{stackPaintSizee},
 					stackSize{stackSizee},
 					canReceiveSignals{canReceiveSignalss},
 					priority{priorityy},
@@ -64,11 +70,15 @@ struct DynamicThreadParameters
 	 * \param [in] stackSizee is the size of stack, bytes
 	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
 	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 * \param [in] stackPaintSizee is the size of area of the stack which is painted with stack sentinel when the thread
+	 * is started, values greater than \a stackSizee select painting of the whole stack, 0 selects painting of just the
+	 * "stack guard", default - SIZE_MAX
 	 */
 
 	constexpr DynamicThreadParameters(const size_t stackSizee, const uint8_t priorityy,
-			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
-					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy}
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin,
+			const size_t stackPaintSizee = SIZE_MAX) :
+					DynamicThreadParameters{stackSizee, false, 0, 0, priorityy, schedulingPolicyy, stackPaintSizee}
 	{
 
 	}
@@ -81,6 +91,10 @@ struct DynamicThreadParameters
 	/// to disable catching of signals for this thread
 	size_t signalActions;
 
+	/// size of area of the stack which is painted with stack sentinel when the thread is started, values greater than
+	/// \a stackSize select painting of the whole stack, 0 selects painting of just the "stack guard"
+	size_t stackPaintSize;
+
 	/// size of stack, bytes
 	size_t stackSize;
 
@@ -0,0 +1,454 @@
+/**
+ * \file
+ * \brief EventFlags class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+#define INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+/**
+ * \brief EventFlags is a group of 32 event flags, any number of threads may wait for any or all of selected flags to be
+ * set
+ *
+ * Setting of flags can be done from interrupt context. All threads whose wait is satisfied by setting of flags are
+ * unblocked during single call to set(). If a waiting thread requested automatic clearing of flags, the flags it waited
+ * for are cleared before the next waiting thread is checked - waiting threads are checked in the order in which they
+ * started waiting.
+ *
+ * \ingroup synchronization
+ */
+
+class EventFlags
+{
+public:
+
+	/// type of value of event flags
+	using Value = uint32_t;
+
+	/**
+	 * \brief EventFlags's constructor
+	 *
+	 * \param [in] value is the initial value of event flags, default - 0
+	 */
+
+	constexpr explicit EventFlags(const Value value = {}) :
+			waitersList_{},
+			value_{value}
+	{
+
+	}
+
+	/**
+	 * \brief EventFlags's destructor
+	 *
+	 * It shall be safe to destroy EventFlags upon which no threads are currently blocked. Attempting to destroy
+	 * EventFlags upon which other threads are currently blocked results in undefined behavior.
+	 */
+
+	~EventFlags() = default;
+
+	/**
+	 * \brief Clears selected flags.
+	 *
+	 * \param [in] mask is the bitmask of flags that will be cleared
+	 *
+	 * \return value of event flags before clearing
+	 */
+
+	Value clear(Value mask);
+
+	/**
+	 * \return current value of event flags
+	 */
+
+	Value get() const
+	{
+		return value_;
+	}
+
+	/**
+	 * \brief Sets selected flags.
+	 *
+	 * All waiting threads whose wait is satisfied are unblocked.
+	 *
+	 * \note This function may be called from interrupt context.
+	 *
+	 * \param [in] mask is the bitmask of flags that will be set
+	 *
+	 * \return value of event flags after setting and after automatic clearing requested by unblocked threads
+	 */
+
+	Value set(Value mask);
+
+	/**
+	 * \brief Tries to wait until all selected flags are set.
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EAGAIN - not all selected flags are set;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Value> tryWaitAll(Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAllFor(TickClock::duration duration, Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set for given duration of time.
+	 *
+	 * Template variant of tryWaitAllFor(TickClock::duration, Value, bool).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Value> tryWaitAllFor(const std::chrono::duration<Rep, Period> duration, const Value mask,
+			const bool autoClear = {})
+	{
+		return tryWaitAllFor(std::chrono::duration_cast<TickClock::duration>(duration), mask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until all selected flags are set until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAllUntil(TickClock::time_point timePoint, Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set until given time point.
+	 *
+	 * Template variant of tryWaitAllUntil(TickClock::time_point, Value, bool).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Value> tryWaitAllUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Value mask, const bool autoClear = {})
+	{
+		return tryWaitAllUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), mask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set.
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EAGAIN - none of selected flags is set;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Value> tryWaitAny(Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAnyFor(TickClock::duration duration, Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set for given duration of time.
+	 *
+	 * Template variant of tryWaitAnyFor(TickClock::duration, Value, bool).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Value> tryWaitAnyFor(const std::chrono::duration<Rep, Period> duration, const Value mask,
+			const bool autoClear = {})
+	{
+		return tryWaitAnyFor(std::chrono::duration_cast<TickClock::duration>(duration), mask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAnyUntil(TickClock::time_point timePoint, Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set until given time point.
+	 *
+	 * Template variant of tryWaitAnyUntil(TickClock::time_point, Value, bool).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Value> tryWaitAnyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Value mask, const bool autoClear = {})
+	{
+		return tryWaitAnyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), mask, autoClear);
+	}
+
+	/**
+	 * \brief Waits until all selected flags are set.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Value> waitAll(Value mask, bool autoClear = {});
+
+	/**
+	 * \brief Waits until any of selected flags is set.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false), default - false
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Value> waitAny(Value mask, bool autoClear = {});
+
+	EventFlags(const EventFlags&) = delete;
+	EventFlags(EventFlags&&) = delete;
+	const EventFlags& operator=(const EventFlags&) = delete;
+	EventFlags& operator=(EventFlags&&) = delete;
+
+private:
+
+	/// Waiter describes one thread waiting for event flags, it lives on the stack of this thread
+	class Waiter
+	{
+	public:
+
+		/**
+		 * \brief Waiter's constructor
+		 *
+		 * \param [in] waitMask is the bitmask of flags for which the wait is done
+		 * \param [in] waitForAll selects whether all (true) or any (false) of flags selected by \a waitMask must be set
+		 * \param [in] clearWhenSatisfied selects whether flags selected by \a waitMask will be cleared when the wait is
+		 * satisfied (true) or not (false)
+		 */
+
+		constexpr Waiter(const Value waitMask, const bool waitForAll, const bool clearWhenSatisfied) :
+				node{},
+				threadList{},
+				mask{waitMask},
+				value{},
+				all{waitForAll},
+				autoClear{clearWhenSatisfied}
+		{
+
+		}
+
+		/// node for intrusive list
+		estd::IntrusiveListNode node;
+
+		/// list with waiting thread, empty when the wait is already finished
+		internal::ThreadList threadList;
+
+		/// bitmask of flags for which the wait is done
+		Value mask;
+
+		/// value of event flags which satisfied the wait
+		Value value;
+
+		/// selects whether all (true) or any (false) of flags selected by mask must be set
+		bool all;
+
+		/// selects whether flags selected by mask will be cleared when the wait is satisfied (true) or not (false)
+		bool autoClear;
+	};
+
+	/// type of list of waiters
+	using WaitersList = estd::IntrusiveList<Waiter, &Waiter::node>;
+
+	/**
+	 * \brief Tries to wait for flags.
+	 *
+	 * Internal version - with no interrupt masking.
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] all selects whether all (true) or any (false) of flags selected by \a mask must be set
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EAGAIN - required combination of flags is not set;
+	 * - EINVAL - \a mask is 0;
+	 */
+
+	std::pair<int, Value> tryWaitInternal(Value mask, bool all, bool autoClear);
+
+	/**
+	 * \brief Waits for flags.
+	 *
+	 * \param [in] mask is the bitmask of flags for which the wait is done
+	 * \param [in] all selects whether all (true) or any (false) of flags selected by \a mask must be set
+	 * \param [in] autoClear selects whether flags selected by \a mask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to wait without
+	 * timeout
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of event flags which satisfied the
+	 * wait (before automatic clearing) or current value of event flags on failure; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a mask is 0;
+	 * - ETIMEDOUT - no required combination of flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> waitInternal(Value mask, bool all, bool autoClear, const TickClock::time_point* timePoint);
+
+	/// list of waiters, in the order in which they started waiting
+	WaitersList waitersList_;
+
+	/// current value of event flags
+	Value value_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueue class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -77,6 +77,23 @@ public:
 
 	~FifoQueue();
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), tryReserve(), tryReserveFor() or tryReserveUntil().
+	 *
+	 * Elements become available for popping in the order of their slots, so the element is published when all
+	 * outstanding reservations are committed. Elements pushed while any reservation is outstanding are published at
+	 * the same time. The element must be constructed in the slot before it is committed.
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EPERM - there are no outstanding reservations;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit()
+	{
+		return fifoQueueBase_.commit();
+	}
+
 	/**
 	 * \brief Emplaces the element in the queue.
 	 *
@@ -109,6 +126,38 @@ public:
 		return fifoQueueBase_.getCapacity();
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return fifoQueueBase_.getPopSemaphore();
+	}
+
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * The element is not moved - it can be accessed in place, with interrupts enabled. It is destructed and its slot is
+	 * freed when it is released with release(). Slots are freed in the order of their elements, so the slot becomes
+	 * available for pushing when all outstanding peeks are released.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peek(T*& element)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return peekInternal(semaphoreWaitFunctor, element);
+	}
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -128,6 +177,32 @@ public:
 		return popInternal(semaphoreWaitFunctor, value);
 	}
 
+	/**
+	 * \brief Pops the oldest (first) elements from the queue.
+	 *
+	 * Waits until at least one element is available, then pops as many elements as possible (but no more than
+	 * \a maxCount).
+	 * Elements available after the first one are popped without waiting, all of them in one critical section, so the
+	 * whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatch(T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popBatchInternal(semaphoreWaitFunctor, values, maxCount);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -165,6 +240,31 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements as possible (but no more than \a count).
+	 * Elements which fit in the queue after the first one are pushed without waiting, all of them in one critical
+	 * section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatch(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushBatchInternal(semaphoreWaitFunctor, values, count);
+	}
+
 	/**
 	 * \brief Tries to emplace the element in the queue.
 	 *
@@ -288,6 +388,142 @@ public:
 				std::forward<Args>(args)...);
 	}
 
+	/**
+	 * \brief Releases the element peeked with peek(), tryPeek(), tryPeekFor() or tryPeekUntil().
+	 *
+	 * \param [in] element is a reference to peeked element, it is destructed if there are outstanding peeks
+	 *
+	 * \return 0 if element was released successfully, error code otherwise:
+	 * - EPERM - there are no outstanding peeks, \a element is not destructed;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(T& element)
+	{
+		const auto destroyFunctor = internal::makeBoundQueueFunctor(
+				[](void* const storage)
+				{
+					static_cast<T*>(storage)->~T();
+				});
+		return fifoQueueBase_.release(destroyFunctor, &element);
+	}
+
+	/**
+	 * \brief Reserves the slot for the element in the queue.
+	 *
+	 * The element is not copied or moved - it must be constructed directly in the reserved slot (with placement new),
+	 * with interrupts enabled. The element is published when the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reserve(void*& slot)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return fifoQueueBase_.reserve(semaphoreWaitFunctor, slot);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue.
+	 *
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeek(T*& element)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return peekInternal(semaphoreTryWaitFunctor, element);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekFor(const TickClock::duration duration, T*& element)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return peekInternal(semaphoreTryWaitForFunctor, element);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration, T*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekFor(const std::chrono::duration<Rep, Period> duration, T*& element)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration), element);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekUntil(const TickClock::time_point timePoint, T*& element)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return peekInternal(semaphoreTryWaitUntilFunctor, element);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point, T*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T*& element)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), element);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -394,6 +630,133 @@ public:
 		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
 	}
 
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue.
+	 *
+	 * Pops as many elements as are available (but no more than \a maxCount), all of them in one critical section.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatch(T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popBatchInternal(semaphoreTryWaitFunctor, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one element is available, then pops as many elements as
+	 * possible (but no more than \a maxCount), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchFor(const TickClock::duration duration, T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popBatchInternal(semaphoreTryWaitForFunctor, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopBatchFor(TickClock::duration, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopBatchFor(const std::chrono::duration<Rep, Period> duration, T* const values,
+			const size_t maxCount)
+	{
+		return tryPopBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one element, then pops as many elements as possible (but no more
+	 * than \a maxCount), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchUntil(const TickClock::time_point timePoint, T* const values,
+			const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popBatchInternal(semaphoreTryWaitUntilFunctor, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopBatchUntil(TickClock::time_point, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			T* const values, const size_t maxCount)
+	{
+		return tryPopBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, maxCount);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue.
 	 *
@@ -601,6 +964,230 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), std::move(value));
 	}
 
+	/**
+	 * \brief Tries to push the elements to the queue.
+	 *
+	 * Pushes as many elements as fit in the queue (but no more than \a count), all of them in one critical section.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatch(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushBatchInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one slot is free, then pushes as many elements as possible
+	 * (but no more than \a count), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchFor(const TickClock::duration duration, const T* const values,
+			const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushBatchInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushBatchFor(TickClock::duration, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushBatchFor(const std::chrono::duration<Rep, Period> duration, const T* const values,
+			const size_t count)
+	{
+		return tryPushBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one free slot, then pushes as many elements as possible (but no
+	 * more than \a count), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchUntil(const TickClock::time_point timePoint, const T* const values,
+			const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushBatchInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushBatchUntil(TickClock::time_point, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const values, const size_t count)
+	{
+		return tryPushBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue.
+	 *
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReserve(void*& slot)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return fifoQueueBase_.reserve(semaphoreTryWaitFunctor, slot);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReserveFor(const TickClock::duration duration, void*& slot)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return fifoQueueBase_.reserve(semaphoreTryWaitForFunctor, slot);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReserveFor(const std::chrono::duration<Rep, Period> duration, void*& slot)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration), slot);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReserveUntil(const TickClock::time_point timePoint, void*& slot)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return fifoQueueBase_.reserve(semaphoreTryWaitUntilFunctor, slot);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved uninitialized slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& slot)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slot);
+	}
+
 private:
 
 	/**
@@ -623,6 +1210,20 @@ private:
 	template<typename... Args>
 	int emplaceInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, Args&&... args);
 
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * Internal version - converts pointer to peeked element.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peekInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T*& element);
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -639,6 +1240,25 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
 
+	/**
+	 * \brief Pops the oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* values,
+			size_t maxCount);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -670,6 +1290,25 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* values,
+			size_t count);
+
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -693,6 +1332,16 @@ int FifoQueue<T>::emplaceInternal(const internal::SemaphoreFunctor& waitSemaphor
 	return fifoQueueBase_.push(waitSemaphoreFunctor, emplaceFunctor);
 }
 
+template<typename T>
+int FifoQueue<T>::peekInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T*& element)
+{
+	void* storage;
+	const auto ret = fifoQueueBase_.peek(waitSemaphoreFunctor, storage);
+	if (ret == 0)
+		element = reinterpret_cast<T*>(storage);
+	return ret;
+}
+
 template<typename T>
 int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value)
 {
@@ -700,6 +1349,19 @@ int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		T* values, const size_t maxCount)
+{
+	const auto swapPopFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {*values++};
+				swapPopQueueFunctor(storage);
+			});
+	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopFunctor, maxCount);
+}
+
 template<typename T>
 int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
@@ -714,6 +1376,19 @@ int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const T* values, const size_t count)
+{
+	const auto copyConstructFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				new (storage) T{*values++};
+			});
+	return fifoQueueBase_.push(waitSemaphoreFunctor, copyConstructFunctor, count);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
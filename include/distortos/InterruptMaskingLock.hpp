@@ -2,7 +2,7 @@
  * \file
  * \brief InterruptMaskingLock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,14 +16,41 @@
 
 #include "distortos/internal/synchronization/InterruptMaskingUnmaskingLock.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#include "distortos/internal/synchronization/InterruptMaskingMonitor.hpp"
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
 namespace distortos
 {
 
 /// InterruptMaskingLock class is a RAII wrapper for
 /// architecture::enableInterruptMasking() / architecture::restoreInterruptMasking()
 class InterruptMaskingLock : private internal::InterruptMaskingUnmaskingLock<architecture::enableInterruptMasking>
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+		, private internal::InterruptMaskingMonitor::MaskingGuard
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
 {
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+public:
+
+	/**
+	 * \brief InterruptMaskingLock's constructor
+	 *
+	 * Always inlined, so the address recorded by internal::InterruptMaskingMonitor::MaskingGuard is in the code which
+	 * uses this lock.
+	 */
+
+	__attribute__ ((always_inline)) InterruptMaskingLock()
+	{
+
+	}
 
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
 };
 
 }	// namespace distortos
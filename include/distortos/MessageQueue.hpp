@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueue class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -22,6 +22,8 @@
 #include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
 
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
 #if __GNUC_PREREQ(5, 1) != 1
 // GCC 4.8 doesn't support parameter pack expansion in lambdas
 #error "GCC 5.1 is the minimum version supported by distortos"
@@ -63,6 +65,12 @@ public:
 	using ValueStorageUniquePointer =
 			std::unique_ptr<ValueStorage[], internal::MessageQueueBase::ValueStorageUniquePointer::deleter_type>;
 
+	/// import PriorityBuckets type from internal::MessageQueueBase class
+	using PriorityBuckets = internal::MessageQueueBase::PriorityBuckets;
+
+	/// import PriorityBucketsUniquePointer type from internal::MessageQueueBase class
+	using PriorityBucketsUniquePointer = internal::MessageQueueBase::PriorityBucketsUniquePointer;
+
 	/**
 	 * \brief MessageQueue's constructor
 	 *
@@ -75,9 +83,30 @@ public:
 
 	MessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
 			ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t maxElements) :
+			MessageQueue{std::move(entryStorageUniquePointer), std::move(valueStorageUniquePointer), maxElements,
+					{nullptr, internal::dummyDeleter<PriorityBuckets>}}
+	{
+
+	}
+
+	/**
+	 * \brief MessageQueue's constructor
+	 *
+	 * \param [in] entryStorageUniquePointer is a rvalue reference to EntryStorageUniquePointer with storage for queue
+	 * entries (sufficiently large for \a maxElements EntryStorage objects) and appropriate deleter
+	 * \param [in] valueStorageUniquePointer is a rvalue reference to ValueStorageUniquePointer with storage for queue
+	 * elements (sufficiently large for \a maxElements, each sizeof(T) bytes long) and appropriate deleter
+	 * \param [in] maxElements is the number of elements in \a entryStorage and \a valueStorage arrays
+	 * \param [in] priorityBucketsUniquePointer is a rvalue reference to PriorityBucketsUniquePointer with
+	 * PriorityBuckets object and appropriate deleter, nullptr to link new elements with linear search of the queue
+	 */
+
+	MessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
+			ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t maxElements,
+			PriorityBucketsUniquePointer&& priorityBucketsUniquePointer) :
 			messageQueueBase_{std::move(entryStorageUniquePointer),
 					{valueStorageUniquePointer.release(), valueStorageUniquePointer.get_deleter()},
-					sizeof(*valueStorageUniquePointer.get()), maxElements}
+					sizeof(*valueStorageUniquePointer.get()), maxElements, std::move(priorityBucketsUniquePointer)}
 	{
 
 	}
@@ -125,6 +154,17 @@ public:
 		return messageQueueBase_.getCapacity();
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return messageQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -147,6 +187,35 @@ public:
 		return popInternal(semaphoreWaitFunctor, priority, value);
 	}
 
+	/**
+	 * \brief Pops the oldest elements with highest priority from the queue.
+	 *
+	 * Similar to mq_receive() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/mq_receive.html#
+	 *
+	 * Waits until at least one element is available, then pops as many elements as possible (but no more than
+	 * \a maxCount). Elements available after the first one are popped without waiting, all of them in one critical
+	 * section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatch(uint8_t* const priorities, T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popBatchInternal(semaphoreWaitFunctor, priorities, values, maxCount);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -190,6 +259,34 @@ public:
 		return pushInternal(semaphoreWaitFunctor, priority, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Similar to mq_send() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/mq_send.html#
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements as possible (but no more than \a count).
+	 * Elements which fit in the queue after the first one are pushed without waiting, all of them in one critical
+	 * section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatch(const uint8_t priority, const T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushBatchInternal(semaphoreWaitFunctor, priority, values, count);
+	}
+
 	/**
 	 * \brief Tries to emplace the element in the queue.
 	 *
@@ -443,6 +540,145 @@ public:
 		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, value);
 	}
 
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue.
+	 *
+	 * Pops as many elements as are available (but no more than \a maxCount), all of them in one critical section.
+	 *
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatch(uint8_t* const priorities, T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popBatchInternal(semaphoreTryWaitFunctor, priorities, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one element is available, then pops as many elements as
+	 * possible (but no more than \a maxCount), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchFor(const TickClock::duration duration, uint8_t* const priorities,
+			T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popBatchInternal(semaphoreTryWaitForFunctor, priorities, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopBatchFor(TickClock::duration, uint8_t*, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopBatchFor(const std::chrono::duration<Rep, Period> duration, uint8_t* const priorities,
+			T* const values, const size_t maxCount)
+	{
+		return tryPopBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), priorities, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one element, then pops as many elements as possible (but no more than
+	 * \a maxCount), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchUntil(const TickClock::time_point timePoint, uint8_t* const priorities,
+			T* const values, const size_t maxCount)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popBatchInternal(semaphoreTryWaitUntilFunctor, priorities, values, maxCount);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue until a given time point.
+	 *
+	 * Template variant of tryPopBatchUntil(TickClock::time_point, uint8_t*, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			uint8_t* const priorities, T* const values, const size_t maxCount)
+	{
+		return tryPopBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priorities, values,
+				maxCount);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue.
 	 *
@@ -673,6 +909,139 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, std::move(value));
 	}
 
+	/**
+	 * \brief Tries to push the elements to the queue.
+	 *
+	 * Pushes as many elements as fit in the queue (but no more than \a count), all of them in one critical section.
+	 *
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatch(const uint8_t priority, const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushBatchInternal(semaphoreTryWaitFunctor, priority, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one slot is free, then pushes as many elements as possible (but
+	 * no more than \a count), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchFor(const TickClock::duration duration, const uint8_t priority,
+			const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushBatchInternal(semaphoreTryWaitForFunctor, priority, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushBatchFor(TickClock::duration, uint8_t, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushBatchFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority,
+			const T* const values, const size_t count)
+	{
+		return tryPushBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one free slot, then pushes as many elements as possible (but no more
+	 * than \a count), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchUntil(const TickClock::time_point timePoint, const uint8_t priority,
+			const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushBatchInternal(semaphoreTryWaitUntilFunctor, priority, values, count);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushBatchUntil(TickClock::time_point, uint8_t, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const uint8_t priority, const T* const values, const size_t count)
+	{
+		return tryPushBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, values, count);
+	}
+
 private:
 
 	/**
@@ -713,6 +1082,27 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, T& value);
 
+	/**
+	 * \brief Pops the oldest elements with highest priority from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the maximum number of popped elements, size of \a values and \a priorities arrays
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t* priorities,
+			T* values, size_t maxCount);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -746,6 +1136,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority, T&& value);
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of elements in \a values array
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority,
+			const T* values, size_t count);
+
 	/// contained internal::MessageQueueBase object which implements whole functionality
 	internal::MessageQueueBase messageQueueBase_;
 };
@@ -778,6 +1188,19 @@ int MessageQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphore
 	return messageQueueBase_.pop(waitSemaphoreFunctor, priority, swapPopQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> MessageQueue<T>::popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		uint8_t* const priorities, T* values, const size_t maxCount)
+{
+	const auto swapPopFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				const internal::SwapPopQueueFunctor<T> swapPopQueueFunctor {*values++};
+				swapPopQueueFunctor(storage);
+			});
+	return messageQueueBase_.pop(waitSemaphoreFunctor, priorities, swapPopFunctor, maxCount);
+}
+
 template<typename T>
 int MessageQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const uint8_t priority,
 		const T& value)
@@ -794,6 +1217,18 @@ int MessageQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphor
 	return messageQueueBase_.push(waitSemaphoreFunctor, priority, moveConstructQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> MessageQueue<T>::pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const uint8_t priority, const T* values, const size_t count)
+{
+	const auto copyConstructFunctor = internal::makeBoundQueueFunctor(
+			[&values](void* const storage)
+			{
+				new (storage) T{*values++};
+			});
+	return messageQueueBase_.push(waitSemaphoreFunctor, priority, copyConstructFunctor, count);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_MESSAGEQUEUE_HPP_
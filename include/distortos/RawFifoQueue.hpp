@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -45,6 +45,23 @@ public:
 
 	RawFifoQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), tryReserve(), tryReserveFor() or tryReserveUntil().
+	 *
+	 * Elements become available for popping in the order of their slots, so the element is published when all
+	 * outstanding reservations are committed. Elements pushed while any reservation is outstanding are published at
+	 * the same time. Slot must be fully written before it is committed.
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EPERM - there are no outstanding reservations;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit()
+	{
+		return fifoQueueBase_.commit();
+	}
+
 	/**
 	 * \return maximum number of elements in queue
 	 */
@@ -63,6 +80,34 @@ public:
 		return fifoQueueBase_.getElementSize();
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return fifoQueueBase_.getPopSemaphore();
+	}
+
+	/**
+	 * \brief Peeks the oldest (first) element in the queue.
+	 *
+	 * The element is not copied - it can be read (or modified) in place, with interrupts enabled. Its slot is freed
+	 * when it is released with release(). Slots are freed in the order of their elements, so the slot becomes
+	 * available for pushing when all outstanding peeks are released.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peek(void*& element);
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -100,6 +145,28 @@ public:
 		return pop(&buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Pops the oldest (first) elements from the queue.
+	 *
+	 * Waits until at least one element is available, then pops as many elements as possible (but no more than fit in
+	 * \a buffer). Elements available after the first one are popped without waiting, all of them in one critical
+	 * section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatch(void* buffer, size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -137,6 +204,141 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements as possible (but no more than are in
+	 * \a data). Elements which fit in the queue after the first one are pushed without waiting, all of them in one
+	 * critical section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatch(const void* data, size_t size);
+
+	/**
+	 * \brief Releases the element peeked with peek(), tryPeek(), tryPeekFor() or tryPeekUntil().
+	 *
+	 * \return 0 if element was released successfully, error code otherwise:
+	 * - EPERM - there are no outstanding peeks;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release()
+	{
+		return fifoQueueBase_.release();
+	}
+
+	/**
+	 * \brief Reserves the slot for the element in the queue.
+	 *
+	 * The element is not copied - it can be written directly to the reserved slot, with interrupts enabled. The element
+	 * is published when the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reserve(void*& slot);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue.
+	 *
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeek(void*& element);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekFor(TickClock::duration duration, void*& element);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekFor(const std::chrono::duration<Rep, Period> duration, void*& element)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration), element);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekUntil(TickClock::time_point timePoint, void*& element);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element in the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] element is a reference to pointer which will be used to return pointer to peeked element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& element)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), element);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -302,6 +504,125 @@ public:
 		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue.
+	 *
+	 * Pops as many elements as are available (but no more than fit in \a buffer), all of them in one critical section.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatch(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one element is available, then pops as many elements as
+	 * possible (but no more than fit in \a buffer), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopBatchFor(TickClock::duration, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopBatchFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size)
+	{
+		return tryPopBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one element, then pops as many elements as possible (but no more than
+	 * fit in \a buffer), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopBatchUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size)
+	{
+		return tryPopBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue.
 	 *
@@ -468,6 +789,210 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to push the elements to the queue.
+	 *
+	 * Pushes as many elements as fit in the queue (but no more than are in \a data), all of them in one critical
+	 * section.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatch(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one slot is free, then pushes as many elements as possible (but
+	 * no more than are in \a data), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchFor(TickClock::duration duration, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushBatchFor(TickClock::duration, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushBatchFor(const std::chrono::duration<Rep, Period> duration, const void* const data,
+			const size_t size)
+	{
+		return tryPushBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one free slot, then pushes as many elements as possible (but no more
+	 * than are in \a data), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchUntil(TickClock::time_point timePoint, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushBatchUntil(TickClock::time_point, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const void* const data, const size_t size)
+	{
+		return tryPushBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue.
+	 *
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReserve(void*& slot);
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReserveFor(TickClock::duration duration, void*& slot);
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReserveFor(const std::chrono::duration<Rep, Period> duration, void*& slot)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration), slot);
+	}
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReserveUntil(TickClock::time_point timePoint, void*& slot);
+
+	/**
+	 * \brief Tries to reserve the slot for the element in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& slot)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), slot);
+	}
+
 private:
 
 	/**
@@ -487,6 +1012,26 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
 
+	/**
+	 * \brief Pops the oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -504,6 +1049,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data,
+			size_t size);
+
 	/// contained internal::FifoQueueBase object which implements base functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
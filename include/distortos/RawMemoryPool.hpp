@@ -0,0 +1,242 @@
+/**
+ * \file
+ * \brief RawMemoryPool class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RAWMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_RAWMEMORYPOOL_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <memory>
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SemaphoreFunctor;
+
+}	// namespace internal
+
+/**
+ * \brief RawMemoryPool class is a fixed-block memory allocator.
+ *
+ * Storage is divided into blocks of equal size. Free blocks are kept on an intrusive singly linked list (pointer to
+ * next free block is stored in the block itself), so both allocation and deallocation take constant time and don't
+ * cause fragmentation. Number of free blocks is tracked with a semaphore, so a thread may wait until some block is
+ * deallocated.
+ *
+ * Blocks may be used as storage for dynamic kernel objects (for example queues) with internal::memoryPoolDeleter().
+ *
+ * \ingroup memory
+ */
+
+class RawMemoryPool
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief RawMemoryPool's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for blocks
+	 * (sufficiently large for \a blocks, each \a blockSize bytes long, aligned at least to alignof(void*)) and
+	 * appropriate deleter
+	 * \param [in] blockSize is the size of single block, bytes, must be a multiple of alignof(void*) and not less than
+	 * sizeof(void*)
+	 * \param [in] blocks is the number of blocks in storage memory block
+	 */
+
+	RawMemoryPool(StorageUniquePointer&& storageUniquePointer, size_t blockSize, size_t blocks);
+
+	/**
+	 * \brief Allocates one block from the pool.
+	 *
+	 * If the pool is empty, the calling thread is blocked until some block is deallocated.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, void*> allocate();
+
+	/**
+	 * \brief Deallocates block which was allocated from the pool.
+	 *
+	 * \note This function may be used from interrupt context.
+	 *
+	 * \param [in] block is a pointer to block which will be deallocated
+	 *
+	 * \return 0 if block was deallocated successfully, error code otherwise:
+	 * - EINVAL - \a block was not allocated from this pool;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int deallocate(void* block);
+
+	/**
+	 * \return size of single block, bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return total number of blocks in the pool
+	 */
+
+	size_t getCapacity() const
+	{
+		return semaphore_.getMaxValue();
+	}
+
+	/**
+	 * \return number of free blocks in the pool
+	 */
+
+	size_t getFreeBlocks() const
+	{
+		return semaphore_.getValue();
+	}
+
+	/**
+	 * \brief Tries to allocate one block from the pool.
+	 *
+	 * \note This function may be used from interrupt context.
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, void*> tryAllocate();
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, void*> tryAllocateFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * Template variant of tryAllocateFor(TickClock::duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryAllocateFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryAllocateFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, void*> tryAllocateUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * Template variant of tryAllocateUntil(TickClock::time_point).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryAllocateUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryAllocateUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	RawMemoryPool(const RawMemoryPool&) = delete;
+	RawMemoryPool(RawMemoryPool&&) = delete;
+	const RawMemoryPool& operator=(const RawMemoryPool&) = delete;
+	RawMemoryPool& operator=(RawMemoryPool&&) = delete;
+
+private:
+
+	/**
+	 * \brief Allocates one block from the pool.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore_
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (nullptr if
+	 * allocation failed); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, void*> allocateInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor);
+
+	/// semaphore guarding access to free blocks, its value is equal to the number of free blocks
+	Semaphore semaphore_;
+
+	/// storage for blocks
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// pointer to past-the-last byte of storage
+	const void* const storageEnd_;
+
+	/// pointer to first free block, nullptr if there are no free blocks
+	void* freeList_;
+
+	/// size of single block, bytes
+	const size_t blockSize_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RAWMEMORYPOOL_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -84,6 +84,17 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return messageQueueBase_.getPopSemaphore();
+	}
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -128,6 +139,32 @@ public:
 		return pop(priority, &buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Pops the oldest elements with highest priority from the queue.
+	 *
+	 * Similar to mq_receive() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/mq_receive.html#
+	 *
+	 * Waits until at least one element is available, then pops as many elements as possible (but no more than fit in
+	 * \a buffer). Elements available after the first one are popped without waiting, all of them in one critical
+	 * section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatch(uint8_t* priorities, void* buffer, size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -171,6 +208,31 @@ public:
 		return push(priority, &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Similar to mq_send() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/mq_send.html#
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements as possible (but no more than are in
+	 * \a data). Elements which fit in the queue after the first one are pushed without waiting, all of them in one
+	 * critical section, so the whole batch costs one wait and one wake-up of the other side.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatch(uint8_t priority, const void* data, size_t size);
+
 	/**
 	 * \brief Tries to pop the oldest element with highest priority from the queue.
 	 *
@@ -364,6 +426,136 @@ public:
 				sizeof(buffer));
 	}
 
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue.
+	 *
+	 * Pops as many elements as are available (but no more than fit in \a buffer), all of them in one critical section.
+	 *
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatch(uint8_t* priorities, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one element is available, then pops as many elements as
+	 * possible (but no more than fit in \a buffer), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchFor(TickClock::duration duration, uint8_t* priorities, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopBatchFor(TickClock::duration, uint8_t*, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopBatchFor(const std::chrono::duration<Rep, Period> duration, uint8_t* const priorities,
+			void* const buffer, const size_t size)
+	{
+		return tryPopBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), priorities, buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one element, then pops as many elements as possible (but no more than
+	 * fit in \a buffer), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopBatchUntil(TickClock::time_point timePoint, uint8_t* priorities, void* buffer,
+			size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest elements with highest priority from the queue until a given time point.
+	 *
+	 * Template variant of tryPopBatchUntil(TickClock::time_point, uint8_t*, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the elements
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			uint8_t* const priorities, void* const buffer, const size_t size)
+	{
+		return tryPopBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priorities, buffer, size);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue.
 	 *
@@ -553,6 +745,133 @@ public:
 				sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to push the elements to the queue.
+	 *
+	 * Pushes as many elements as fit in the queue (but no more than are in \a data), all of them in one critical
+	 * section.
+	 *
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatch(uint8_t priority, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Waits for a given duration of time until at least one slot is free, then pushes as many elements as possible (but
+	 * no more than are in \a data), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchFor(TickClock::duration duration, uint8_t priority, const void* data,
+			size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushBatchFor(TickClock::duration, uint8_t, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushBatchFor(const std::chrono::duration<Rep, Period> duration, const uint8_t priority,
+			const void* const data, const size_t size)
+	{
+		return tryPushBatchFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, data, size);
+	}
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Waits until a given time point for at least one free slot, then pushes as many elements as possible (but no more
+	 * than are in \a data), all of them in one critical section.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushBatchUntil(TickClock::time_point timePoint, uint8_t priority, const void* data,
+			size_t size);
+
+	/**
+	 * \brief Tries to push the elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushBatchUntil(TickClock::time_point, uint8_t, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing the elements
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushBatchUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const uint8_t priority, const void* const data, const size_t size)
+	{
+		return tryPushBatchUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, data, size);
+	}
+
 private:
 
 	/**
@@ -575,6 +894,28 @@ private:
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, void* buffer,
 			size_t size);
 
+	/**
+	 * \brief Pops the oldest elements with highest priority from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] priorities is a pointer to array for priorities of popped elements, nullptr if priorities are
+	 * not needed
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t* priorities,
+			void* buffer, size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -594,6 +935,27 @@ private:
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority, const void* data,
 			size_t size);
 
+	/**
+	 * \brief Pushes the elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawMessageQueue, \a size / \a elementSize is the number of elements in \a data
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawMessageQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority,
+			const void* data, size_t size);
+
 	/// contained internal::MessageQueueBase object which implements base functionality
 	internal::MessageQueueBase messageQueueBase_;
 
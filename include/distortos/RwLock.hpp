@@ -0,0 +1,387 @@
+/**
+ * \file
+ * \brief RwLock class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RWLOCK_HPP_
+#define INCLUDE_DISTORTOS_RWLOCK_HPP_
+
+#include "distortos/Mutex.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief RwLock is a reader-writer lock - it can be owned either by any number of threads in shared mode or by one
+ * thread in exclusive mode
+ *
+ * Similar to std::shared_timed_mutex - https://en.cppreference.com/w/cpp/thread/shared_timed_mutex
+ * Similar to POSIX pthread_rwlock_t -
+ * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_init.html
+ *
+ * Exclusive owner holds internal mutex with priority inheritance protocol for the whole time of its ownership (and also
+ * while it waits for shared owners to unlock the lock). Threads which want to lock the RwLock in any mode while it is
+ * owned exclusively block on this internal mutex, so the exclusive owner inherits the priority of the highest priority
+ * waiting thread. Priority is not inherited by shared owners, as they are not tracked individually.
+ *
+ * \ingroup synchronization
+ */
+
+class RwLock
+{
+public:
+
+	/// preference of lock
+	enum class Preference : uint8_t
+	{
+		/// threads trying to lock RwLock in shared mode are not blocked when it is already locked in shared mode, even
+		/// if some thread waits to lock it in exclusive mode - this maximizes concurrency, but exclusive owner may
+		/// starve
+		readers,
+		/// threads trying to lock RwLock in shared mode are blocked when some thread waits to lock it in exclusive mode
+		writers,
+	};
+
+	/**
+	 * \brief RwLock's constructor
+	 *
+	 * \param [in] preference is the preference of lock, default - Preference::writers
+	 */
+
+	constexpr explicit RwLock(const Preference preference = Preference::writers) :
+			mutex_{Mutex::Protocol::priorityInheritance},
+			writersList_{},
+			writer_{},
+			readersCount_{},
+			preference_{preference}
+	{
+
+	}
+
+	/**
+	 * \brief RwLock's destructor
+	 *
+	 * It shall be safe to destroy an initialized RwLock that is unlocked. Attempting to destroy a locked RwLock, or a
+	 * RwLock that another thread is attempting to lock, results in undefined behavior.
+	 */
+
+	~RwLock() = default;
+
+	/**
+	 * \return preference of lock
+	 */
+
+	Preference getPreference() const
+	{
+		return preference_;
+	}
+
+	/**
+	 * \brief Locks the RwLock in exclusive mode.
+	 *
+	 * Similar to std::shared_timed_mutex::lock() - https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock
+	 * Similar to pthread_rwlock_wrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_wrlock.html
+	 *
+	 * If the RwLock is already locked (in any mode) by another thread, the calling thread shall block until the RwLock
+	 * becomes available. If a thread attempts to relock a RwLock that it has already locked (in any mode), deadlock
+	 * occurs.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::lock();
+	 */
+
+	int lock();
+
+	/**
+	 * \brief Locks the RwLock in shared mode.
+	 *
+	 * Similar to std::shared_timed_mutex::lock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/lock_shared
+	 * Similar to pthread_rwlock_rdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html
+	 *
+	 * If the RwLock is locked in exclusive mode by another thread (or - when preference of lock is Preference::writers
+	 * - some thread waits to lock it in exclusive mode), the calling thread shall block until the RwLock becomes
+	 * available. If a thread attempts to lock a RwLock in shared mode when it has already locked it in exclusive mode,
+	 * deadlock occurs.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::lock();
+	 */
+
+	int lockShared();
+
+	/**
+	 * \brief Tries to lock the RwLock in exclusive mode.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock
+	 * Similar to pthread_rwlock_trywrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_trywrlock.html
+	 *
+	 * This function shall be equivalent to lock(), except that if the RwLock is currently locked (in any mode, by any
+	 * thread, including the current thread), the call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - EBUSY - the RwLock could not be acquired because it was already locked;
+	 */
+
+	int tryLock();
+
+	/**
+	 * \brief Tries to lock the RwLock in exclusive mode for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_for() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_for
+	 * Similar to pthread_rwlock_timedwrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - ETIMEDOUT - the RwLock could not be locked before the specified timeout expired;
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	int tryLockFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the RwLock in exclusive mode for given duration of time.
+	 *
+	 * Template variant of tryLockFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - ETIMEDOUT - the RwLock could not be locked before the specified timeout expired;
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the RwLock in shared mode.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared
+	 * Similar to pthread_rwlock_tryrdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_tryrdlock.html
+	 *
+	 * This function shall be equivalent to lockShared(), except that if the calling thread would have to block, the
+	 * call shall return immediately.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - EBUSY - the RwLock could not be acquired because it was locked in exclusive mode (or - when preference of lock
+	 * is Preference::writers - some thread waits to lock it in exclusive mode);
+	 */
+
+	int tryLockShared();
+
+	/**
+	 * \brief Tries to lock the RwLock in shared mode for given duration of time.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_for() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_for
+	 * Similar to pthread_rwlock_timedrdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	int tryLockSharedFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the RwLock in shared mode for given duration of time.
+	 *
+	 * Template variant of tryLockSharedFor(TickClock::duration duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockSharedFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockSharedFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the RwLock in shared mode until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_shared_until() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_shared_until
+	 * Similar to pthread_rwlock_timedrdlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	int tryLockSharedUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the RwLock in shared mode until given time point.
+	 *
+	 * Template variant of tryLockSharedUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	template<typename Duration>
+	int tryLockSharedUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockSharedUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Tries to lock the RwLock in exclusive mode until given time point.
+	 *
+	 * Similar to std::shared_timed_mutex::try_lock_until() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/try_lock_until
+	 * Similar to pthread_rwlock_timedwrlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - ETIMEDOUT - the RwLock could not be locked before the specified timeout expired;
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	int tryLockUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the RwLock in exclusive mode until given time point.
+	 *
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking the RwLock
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - ETIMEDOUT - the RwLock could not be locked before the specified timeout expired;
+	 * - error codes returned by Mutex::tryLockUntil();
+	 */
+
+	template<typename Duration>
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Unlocks the RwLock.
+	 *
+	 * Similar to std::shared_timed_mutex::unlock() and std::shared_timed_mutex::unlock_shared() -
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock
+	 * https://en.cppreference.com/w/cpp/thread/shared_timed_mutex/unlock_shared
+	 * Similar to pthread_rwlock_unlock() -
+	 * https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html
+	 *
+	 * If the RwLock is locked in exclusive mode, it must be locked by the current thread. If it is locked in shared
+	 * mode, the current thread must be one of its shared owners, otherwise the behavior is undefined. When the last
+	 * shared owner unlocks the RwLock, the thread waiting to lock it in exclusive mode (if any) is unblocked.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 if the caller successfully unlocked the RwLock, error code otherwise:
+	 * - EPERM - the RwLock is locked in exclusive mode by another thread or it is not locked at all;
+	 */
+
+	int unlock();
+
+	RwLock(const RwLock&) = delete;
+	RwLock(RwLock&&) = delete;
+	const RwLock& operator=(const RwLock&) = delete;
+	RwLock& operator=(RwLock&&) = delete;
+
+private:
+
+	/**
+	 * \brief Finishes locking of the RwLock in exclusive mode.
+	 *
+	 * Must be called with interrupts masked, after internal mutex was locked. If there are shared owners, the calling
+	 * thread is blocked until the last of them unlocks the RwLock. If the wait fails, internal mutex is unlocked.
+	 *
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to wait without
+	 * timeout
+	 *
+	 * \return 0 if the caller successfully locked the RwLock, error code otherwise:
+	 * - ETIMEDOUT - shared owners did not unlock the RwLock before the specified timeout expired;
+	 */
+
+	int waitForReaders(const TickClock::time_point* timePoint);
+
+	/// internal mutex with priority inheritance protocol, locked by exclusive owner and waiting exclusive owner
+	Mutex mutex_;
+
+	/// list of threads (at most one - the owner of internal mutex) waiting for shared owners to unlock the RwLock
+	internal::ThreadList writersList_;
+
+	/// exclusive owner of the RwLock, nullptr if it is not locked in exclusive mode
+	const internal::ThreadControlBlock* writer_;
+
+	/// number of shared owners of the RwLock
+	size_t readersCount_;
+
+	/// preference of lock
+	Preference preference_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RWLOCK_HPP_
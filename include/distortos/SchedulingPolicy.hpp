@@ -2,7 +2,7 @@
  * \file
  * \brief SchedulingPolicy enum class header
  *
- * \author Copyright (C) 2014 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_SCHEDULINGPOLICY_HPP_
 #define INCLUDE_DISTORTOS_SCHEDULINGPOLICY_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include <cstdint>
 
 namespace distortos
@@ -29,6 +31,13 @@ enum class SchedulingPolicy : uint8_t
 	fifo,
 	/// round-robin scheduling policy
 	roundRobin,
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/// earliest-deadline-first scheduling policy - threads with the same effective priority are ordered by deadline
+	deadline,
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 };
 
 }	// namespace distortos
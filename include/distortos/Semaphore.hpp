@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,14 @@
 
 #include "distortos/TickClock.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#include "distortos/internal/synchronization/WaitForAnyNode.hpp"
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
 namespace distortos
 {
 
@@ -29,6 +37,13 @@ namespace distortos
 
 class Semaphore
 {
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+	friend std::pair<int, size_t> internal::waitForAny(Semaphore* const* semaphores, internal::WaitForAnyNode* nodes,
+			size_t count, const TickClock::time_point* timePoint);
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
 public:
 
 	/// type used for semaphore's "value"
@@ -47,6 +62,9 @@ public:
 
 	constexpr explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
 			blockedList_{},
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+			waitForAnyList_{},
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
 			value_{value < maxValue ? value : maxValue},
 			maxValue_{maxValue}
 	{
@@ -98,6 +116,8 @@ public:
 	 * shall be unblocked, and if there is more than one highest priority thread blocked waiting for the semaphore, then
 	 * the highest priority thread that has been waiting the longest shall be unblocked.
 	 *
+	 * If the value of semaphore is incremented, all threads waiting for this semaphore in waitForAny() are unblocked.
+	 *
 	 * \return 0 if the calling process successfully "posted" the semaphore, error code otherwise:
 	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
 	 */
@@ -235,6 +255,31 @@ public:
 
 private:
 
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	/**
+	 * \brief Tries to post (unlock) the semaphore without enabling interrupt masking.
+	 *
+	 * The value of semaphore is incremented only if it is less than max value, no threads are blocked on the semaphore
+	 * (or wait for it in waitForAny()) and the operation is not interrupted.
+	 *
+	 * \return true if the semaphore was posted, false if the regular way (with interrupt masking enabled) must be used
+	 */
+
+	bool tryFastPost();
+
+	/**
+	 * \brief Tries to lock the semaphore without enabling interrupt masking.
+	 *
+	 * The value of semaphore is decremented only if it is greater than 0 and the operation is not interrupted.
+	 *
+	 * \return true if the semaphore was locked, false if the regular way (with interrupt masking enabled) must be used
+	 */
+
+	bool tryFastWait();
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 	/**
 	 * \brief Internal version of tryWait().
 	 *
@@ -249,6 +294,13 @@ private:
 	/// ThreadControlBlock objects blocked on this semaphore
 	internal::ThreadList blockedList_;
 
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+	/// nodes of threads waiting for this semaphore in waitForAny()
+	internal::WaitForAnyList waitForAnyList_;
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
 	/// internal value of the semaphore
 	Value value_;
 
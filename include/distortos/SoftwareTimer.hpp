@@ -34,6 +34,11 @@ public:
 	virtual ~SoftwareTimer() = default;
 
 	/**
+	 * \note Periodic timer is reported as running until it is stopped, also while its function is executed. One-shot
+	 * timer is reported as running until its function is about to be executed - if the function is executed in timer
+	 * service thread, this includes the time spent in the queue of the thread, so the timer may still be reported as
+	 * running after it has expired.
+	 *
 	 * \return true if the timer is running, false otherwise
 	 */
 
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerCommon class header
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,6 +19,13 @@
 namespace distortos
 {
 
+namespace internal
+{
+
+class Scheduler;
+
+}	// namespace internal
+
 /**
  * \brief SoftwareTimerCommon class implements common functionality of software timers
  *
@@ -27,6 +34,8 @@ namespace distortos
 
 class SoftwareTimerCommon : public SoftwareTimer
 {
+	friend internal::Scheduler;
+
 public:
 
 	/**
@@ -0,0 +1,342 @@
+/**
+ * \file
+ * \brief SpscFifoQueue class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_SPSCFIFOQUEUE_HPP_
+#define INCLUDE_DISTORTOS_SPSCFIFOQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <array>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/**
+ * \brief SpscFifoQueue class is a lock-free FIFO queue for single producer and single consumer, intended mainly for
+ * interrupt-thread communication with high throughput.
+ *
+ * Read and write positions are free-running counters, wrapping around at the range of size_t. As the capacity of queue
+ * is a power of two, index of slot is obtained by masking the position and the number of elements is the difference of
+ * positions, so all slots can be used. Pushing and popping only use atomic loads and stores of positions - there is no
+ * interrupt masking on the data path and the queue can be used on all ARM cores, including ARMv6-M without exclusive
+ * access instructions.
+ *
+ * Producer never blocks. Consumer may block, waiting on internal binary semaphore, which is posted by producer only
+ * when it pushes an element to a queue which was empty, so in a steady stream of data the semaphore is not used at all.
+ *
+ * \warning At any time at most one context (thread or interrupt) may push to the queue and at most one context may pop
+ * from the queue.
+ *
+ * \tparam T is the type of data in queue
+ * \tparam QueueSize is the maximum number of elements in queue, must be a power of two
+ *
+ * \ingroup queues
+ */
+
+template<typename T, size_t QueueSize>
+class SpscFifoQueue
+{
+	static_assert(QueueSize != 0 && (QueueSize & (QueueSize - 1)) == 0, "Size of queue must be a power of two!");
+
+public:
+
+	/// type of uninitialized storage for data
+	using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	/// type of data in queue
+	using ValueType = T;
+
+	/**
+	 * \brief SpscFifoQueue's constructor
+	 */
+
+	SpscFifoQueue() :
+			storage_{},
+			semaphore_{0, 1},
+			readPosition_{},
+			writePosition_{}
+	{
+
+	}
+
+	/**
+	 * \brief SpscFifoQueue's destructor
+	 *
+	 * Destructs all remaining elements in the queue.
+	 */
+
+	~SpscFifoQueue()
+	{
+		for (auto position = readPosition_.load(); position != writePosition_.load(); ++position)
+			getElement(position).~T();
+	}
+
+	/**
+	 * \return maximum number of elements in queue
+	 */
+
+	constexpr static size_t getCapacity()
+	{
+		return QueueSize;
+	}
+
+	/**
+	 * \return current number of elements in queue
+	 */
+
+	size_t getSize() const
+	{
+		const auto readPosition = readPosition_.load();
+		return writePosition_.load() - readPosition;
+	}
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int pop(T& value)
+	{
+		while (tryPop(value) != 0)
+		{
+			const auto ret = semaphore_.wait();
+			if (ret != 0)
+				return ret;
+		}
+
+		return 0;
+	}
+
+	/**
+	 * \brief Tries to emplace the element in the queue.
+	 *
+	 * \tparam Args are types of arguments for constructor of T
+	 *
+	 * \param [in] args are arguments for constructor of T
+	 *
+	 * \return 0 if element was emplaced successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - error codes returned by Semaphore::post() (except EOVERFLOW);
+	 */
+
+	template<typename... Args>
+	int tryEmplace(Args&&... args)
+	{
+		const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+		if (writePosition - readPosition_.load() == QueueSize)
+			return EAGAIN;
+
+		new (&storage_[writePosition & positionMask_]) T{std::forward<Args>(args)...};
+		writePosition_.store(writePosition + 1);
+
+		// consumer may be waiting only if it already popped all previous elements - write position is stored before
+		// read position is loaded and consumer does the same in opposite order, so at least one side notices the other
+		if (readPosition_.load() != writePosition)
+			return 0;
+
+		const auto ret = semaphore_.post();
+		return ret != EOVERFLOW ? ret : 0;
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 */
+
+	int tryPop(T& value)
+	{
+		const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+		if (writePosition_.load() == readPosition)
+			return EAGAIN;
+
+		auto& element = getElement(readPosition);
+		value = std::move(element);
+		element.~T();
+		readPosition_.store(readPosition + 1);
+		return 0;
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopFor(const TickClock::duration duration, T& value)
+	{
+		return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, T&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& value)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopUntil(const TickClock::time_point timePoint, T& value)
+	{
+		while (tryPop(value) != 0)
+		{
+			const auto ret = semaphore_.tryWaitUntil(timePoint);
+			if (ret != 0)
+				return ret;
+		}
+
+		return 0;
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, T&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] value is a reference to object that will be used to return popped value, it is move-assigned from
+	 * the value in the queue's storage
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& value)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \param [in] value is a reference to object that will be pushed, value in queue's storage is copy-constructed
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - error codes returned by Semaphore::post() (except EOVERFLOW);
+	 */
+
+	int tryPush(const T& value)
+	{
+		return tryEmplace(value);
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \param [in] value is a rvalue reference to object that will be pushed, value in queue's storage is
+	 * move-constructed
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - error codes returned by Semaphore::post() (except EOVERFLOW);
+	 */
+
+	int tryPush(T&& value)
+	{
+		return tryEmplace(std::move(value));
+	}
+
+	SpscFifoQueue(const SpscFifoQueue&) = delete;
+	SpscFifoQueue(SpscFifoQueue&&) = delete;
+	const SpscFifoQueue& operator=(const SpscFifoQueue&) = delete;
+	SpscFifoQueue& operator=(SpscFifoQueue&&) = delete;
+
+private:
+
+	/**
+	 * \param [in] position is the position of element
+	 *
+	 * \return reference to element at \a position
+	 */
+
+	T& getElement(const size_t position)
+	{
+		return reinterpret_cast<T&>(storage_[position & positionMask_]);
+	}
+
+	/// bitmask used to extract index of slot from position
+	constexpr static size_t positionMask_ {QueueSize - 1};
+
+	/// storage for queue's contents
+	std::array<Storage, QueueSize> storage_;
+
+	/// binary semaphore used by consumer to wait for elements
+	Semaphore semaphore_;
+
+	/// position of the oldest element, modified only by consumer
+	std::atomic<size_t> readPosition_;
+
+	/// position of the first free slot, modified only by producer
+	std::atomic<size_t> writePosition_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_SPSCFIFOQUEUE_HPP_
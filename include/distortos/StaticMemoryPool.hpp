@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief StaticMemoryPool class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+
+#include "distortos/StaticRawMemoryPool.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief StaticMemoryPool class is a variant of StaticRawMemoryPool with blocks suitable for objects of given type.
+ *
+ * Only raw storage is managed - objects must be constructed in allocated blocks (with placement new) and destroyed
+ * before deallocation by the user.
+ *
+ * \tparam T is the type of objects which will be stored in blocks
+ * \tparam Blocks is the number of blocks in the pool
+ *
+ * \ingroup memory
+ */
+
+template<typename T, size_t Blocks>
+class StaticMemoryPool : public StaticRawMemoryPool<sizeof(T), Blocks, alignof(T)>
+{
+
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief StaticMessageQueue class header
  *
- * \author Copyright (C) 2015-2022 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -26,11 +26,13 @@ namespace distortos
  *
  * \tparam T is the type of data in queue
  * \tparam QueueSize is the maximum number of elements in queue
+ * \tparam UsePriorityBuckets selects whether pushing to the queue takes constant time (true) or linear time (false),
+ * see internal::MessageQueueBase::PriorityBuckets for details, default - false
  *
  * \ingroup queues
  */
 
-template<typename T, size_t QueueSize>
+template<typename T, size_t QueueSize, bool UsePriorityBuckets = {}>
 class StaticMessageQueue : public MessageQueue<T>
 {
 public:
@@ -38,6 +40,9 @@ public:
 	/// import EntryStorage type from base class
 	using typename MessageQueue<T>::EntryStorage;
 
+	/// import PriorityBuckets type from base class
+	using typename MessageQueue<T>::PriorityBuckets;
+
 	/// import ValueStorage type from base class
 	using typename MessageQueue<T>::ValueStorage;
 
@@ -47,7 +52,9 @@ public:
 
 	explicit StaticMessageQueue() :
 			MessageQueue<T>{{entryStorage_.data(), internal::dummyDeleter<EntryStorage>},
-					{valueStorage_.data(), internal::dummyDeleter<ValueStorage>}, valueStorage_.size()}
+					{valueStorage_.data(), internal::dummyDeleter<ValueStorage>}, valueStorage_.size(),
+					{UsePriorityBuckets == true ? priorityBuckets_.data() : nullptr,
+					internal::dummyDeleter<PriorityBuckets>}}
 	{
 
 	}
@@ -68,6 +75,9 @@ private:
 
 	/// storage for queue's contents
 	std::array<ValueStorage, QueueSize> valueStorage_;
+
+	/// index of queue's entries, empty array if not used
+	std::array<PriorityBuckets, UsePriorityBuckets == true ? 1 : 0> priorityBuckets_;
 };
 
 }	// namespace distortos
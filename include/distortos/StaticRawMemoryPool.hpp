@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \brief StaticRawMemoryPool class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICRAWMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICRAWMEMORYPOOL_HPP_
+
+#include "distortos/RawMemoryPool.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticRawMemoryPool class is a variant of RawMemoryPool that has automatic storage for blocks.
+ *
+ * \tparam BlockSize is the requested size of single block, bytes
+ * \tparam Blocks is the number of blocks in the pool
+ * \tparam Alignment is the requested alignment of single block, bytes
+ *
+ * \ingroup memory
+ */
+
+template<size_t BlockSize, size_t Blocks, size_t Alignment = alignof(std::max_align_t)>
+class StaticRawMemoryPool : public RawMemoryPool
+{
+public:
+
+	/**
+	 * \brief StaticRawMemoryPool's constructor
+	 */
+
+	explicit StaticRawMemoryPool() :
+			RawMemoryPool{{storage_.data(), internal::dummyDeleter<Block>}, sizeof(Block), Blocks}
+	{
+
+	}
+
+	/**
+	 * \return total number of blocks in the pool
+	 */
+
+	constexpr static size_t getCapacity()
+	{
+		return Blocks;
+	}
+
+private:
+
+	/// type of single block - large enough and aligned enough to hold both requested block and pointer to next block
+	using Block = typename std::aligned_storage<BlockSize < sizeof(void*) ? sizeof(void*) : BlockSize,
+			Alignment < alignof(void*) ? alignof(void*) : Alignment>::type;
+
+	/// storage for blocks
+	std::array<Block, Blocks> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICRAWMEMORYPOOL_HPP_
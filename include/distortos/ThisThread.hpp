@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -68,6 +68,19 @@ void exit();
 
 Thread& get();
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return deadline of calling (current) thread, TickClock::time_point::max() if the thread doesn't use
+ * SchedulingPolicy::deadline or its deadline was not set
+ */
+
+TickClock::time_point getDeadline();
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 /**
  * \warning This function must not be called from interrupt context!
  *
@@ -114,6 +127,28 @@ size_t getStackHighWaterMark();
 
 size_t getStackSize();
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+/**
+ * \brief Sets deadline of calling (current) thread which uses SchedulingPolicy::deadline.
+ *
+ * Threads with the same effective priority are ordered by their deadlines - thread with the earliest deadline is placed
+ * first. Typical periodic thread sets the deadline of its job when the job is released and blocks (e.g. with
+ * ThisThread::sleepUntil()) when the job is done. Deadline is missed if the thread is still running after this time
+ * point or if it blocks after this time point.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] deadline is the new absolute deadline of calling (current) thread
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - calling (current) thread doesn't use SchedulingPolicy::deadline;
+ */
+
+int setDeadline(TickClock::time_point deadline);
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 /**
  * \brief Changes priority of calling (current) thread.
  *
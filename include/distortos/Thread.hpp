@@ -2,7 +2,7 @@
  * \file
  * \brief Thread class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,12 @@
 #include "distortos/SignalSet.hpp"
 #include "distortos/ThreadState.hpp"
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#include "distortos/TickClock.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 #include <csignal>
 
 namespace distortos
@@ -84,6 +90,33 @@ public:
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \return CPU time of thread (total time during which the thread was running), core clock cycles
+	 */
+
+	virtual uint64_t getCpuTime() const = 0;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \return deadline of thread, TickClock::time_point::max() if the thread doesn't use SchedulingPolicy::deadline or
+	 * its deadline was not set
+	 */
+
+	virtual TickClock::time_point getDeadline() const = 0;
+
+	/**
+	 * \return number of missed deadlines of thread
+	 */
+
+	virtual uint32_t getDeadlineMissCount() const = 0;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -128,11 +161,23 @@ public:
 	virtual SchedulingPolicy getSchedulingPolicy() const = 0;
 
 	/**
-	 * \return "high water mark" (max usage) of thread's stack, bytes
+	 * \brief Gets "high water mark" (max usage) of thread's stack.
+	 *
+	 * If only part of the stack was painted when the thread was started and all of painted area was used, real usage
+	 * is unknown - in that case the size of painted area is returned, so the value equal to getStackPaintedSize()
+	 * means that real usage may be greater.
+	 *
+	 * \return "high water mark" (max usage) of thread's stack, limited to painted area, bytes
 	 */
 
 	virtual size_t getStackHighWaterMark() const = 0;
 
+	/**
+	 * \return size of area of thread's stack which was painted with stack sentinel when the thread was started, bytes
+	 */
+
+	virtual size_t getStackPaintedSize() const = 0;
+
 	/**
 	 * \return size of thread's stack, bytes
 	 */
@@ -192,6 +237,25 @@ public:
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \brief Sets deadline of thread which uses SchedulingPolicy::deadline.
+	 *
+	 * Threads with the same effective priority are ordered by their deadlines - thread with the earliest deadline is
+	 * placed first. Deadline is missed if the thread is still running after this time point or if it blocks after this
+	 * time point.
+	 *
+	 * \param [in] deadline is the new absolute deadline of thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread doesn't use SchedulingPolicy::deadline;
+	 */
+
+	virtual int setDeadline(TickClock::time_point deadline) = 0;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadState enum class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -53,6 +53,10 @@ enum class ThreadState : uint8_t
 
 	/// internal thread object was detached
 	detached,
+	/// thread is blocked on RwLock, waiting for shared owners to unlock it
+	blockedOnRwLock,
+	/// thread is blocked on EventFlags
+	blockedOnEventFlags,
 };
 
 }	// namespace distortos
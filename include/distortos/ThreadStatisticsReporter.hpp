@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \brief ThreadStatisticsReporter class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADSTATISTICSREPORTER_HPP_
+#define INCLUDE_DISTORTOS_THREADSTATISTICSREPORTER_HPP_
+
+#include "distortos/statistics.hpp"
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace devices
+{
+
+class SerialPort;
+
+}	// namespace devices
+
+/**
+ * \brief ThreadStatisticsReporter class formats statistics of all threads of the current thread group as a text table
+ * and writes it to a serial port.
+ *
+ * Each row of the table contains address of the thread object, its priority and effective priority, state, size of
+ * stack, stack "high water mark", number of context switches to the thread and - if CPU time accounting is enabled -
+ * share of CPU time used by the thread since start of accounting.
+ *
+ * Periodic reports can be produced by running run() in a dedicated low-priority thread, for example:
+ *
+ *     auto reporterThread = makeAndStartDynamicThread({1024, 1}, &ThreadStatisticsReporter::run, &reporter,
+ *             std::chrono::seconds{5});
+ *
+ * \ingroup statistics
+ */
+
+class ThreadStatisticsReporter
+{
+public:
+
+	/**
+	 * \brief ThreadStatisticsReporter's constructor
+	 *
+	 * \param [in] serialPort is a reference to serial port to which reports will be written, it must be opened by the
+	 * user
+	 * \param [in] buffer is a pointer to array of ThreadStatistics objects used to collect statistics, its size limits
+	 * the number of reported threads
+	 * \param [in] size is the number of elements in \a buffer
+	 */
+
+	constexpr ThreadStatisticsReporter(devices::SerialPort& serialPort, statistics::ThreadStatistics* const buffer,
+			const size_t size) :
+					serialPort_{serialPort},
+					buffer_{buffer},
+					size_{size}
+	{
+
+	}
+
+	/**
+	 * \brief Collects statistics of all threads of the current thread group and writes a single report to serial port.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by writeLine();
+	 */
+
+	int report();
+
+	/**
+	 * \brief Writes reports to serial port periodically.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] period is the period of reports
+	 *
+	 * \return this function returns only if writing of report fails, in that case it returns error code:
+	 * - error codes returned by report();
+	 */
+
+	int run(TickClock::duration period);
+
+private:
+
+	/**
+	 * \brief Formats a line and writes it to serial port.
+	 *
+	 * \param [in] format is the format string, as in snprintf()
+	 * \param [in] ... are the arguments for \a format
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - formatting of the line failed;
+	 * - error codes returned by devices::SerialPort::write();
+	 */
+
+	int writeLine(const char* format, ...) __attribute__ ((format(printf, 2, 3)));
+
+	/// reference to serial port to which reports are written
+	devices::SerialPort& serialPort_;
+
+	/// pointer to array of ThreadStatistics objects used to collect statistics
+	statistics::ThreadStatistics* buffer_;
+
+	/// number of elements in \a buffer_
+	size_t size_;
+};
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_THREADSTATISTICSREPORTER_HPP_
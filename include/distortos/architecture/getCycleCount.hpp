@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief getCycleCount() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific read of core cycle counter.
+ *
+ * \return current value of free-running 32-bit counter of core clock cycles
+ */
+
+uint32_t getCycleCount();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
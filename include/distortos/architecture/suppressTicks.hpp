@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief suppressTicks() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKS_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKS_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific suppression of "tick" interrupts.
+ *
+ * Reprograms the tick timer as a one-shot timer which expires at the \a ticks -th tick boundary (counted from the last
+ * "tick" interrupt), puts the core to sleep until any interrupt and then restores periodic operation of the tick timer,
+ * keeping it aligned with original tick boundaries. \a ticks may be reduced if it exceeds the range of the tick timer.
+ *
+ * The tick timer is stopped while it is reprogrammed (once before and once after sleep) and the time during which it is
+ * stopped is not accounted for. Tick boundaries after each suppressed period are therefore delayed by the duration of
+ * these two windows - on ARMv6-M and ARMv7-M less than 100 core cycles in total - so TickClock::now() slowly drifts
+ * behind a free-running clock when ticks are suppressed often.
+ *
+ * If the one-shot timer expired, the last tick boundary is signalled with regular "tick" interrupt, which is pending
+ * when this function returns. If the core was woken up earlier by another interrupt, all tick boundaries which elapsed
+ * during sleep are not signalled.
+ *
+ * \note this must be called with interrupt masking enabled, interrupts are handled after interrupt masking is disabled
+ *
+ * \param [in] ticks is the number of tick boundaries to the desired wake-up, must be greater than 1
+ *
+ * \return number of tick boundaries which elapsed without "tick" interrupt
+ */
+
+uint32_t suppressTicks(uint32_t ticks);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKS_HPP_
@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief waitForInterrupt() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific wait for interrupt.
+ *
+ * Puts the core to sleep until any interrupt occurs. The interrupt is handled before this function returns.
+ *
+ * \note this must be called with interrupt masking disabled, otherwise the core may not be woken up
+ */
+
+void waitForInterrupt();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief idleHook() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_IDLEHOOK_H_
+#define INCLUDE_DISTORTOS_IDLEHOOK_H_
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif	/* def __cplusplus */
+
+/**
+ * \brief Hook function called by idle thread.
+ *
+ * This function is called by idle thread in each iteration of its loop, before the core is put to sleep (if tickless
+ * idle mode or sleeping in idle thread is enabled). It may be used for low-priority background work, selection of
+ * low-power mode, etc. It is executed in the context of idle thread, so it must not block and its stack usage must be
+ * very small, as idle thread's stack is only large enough for kernel's own needs.
+ *
+ * \note Use of this function is optional - it may be left undefined, in which case it will not be called.
+ */
+
+void idleHook() __attribute__ ((weak));
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif	/* def __cplusplus */
+
+#endif /* INCLUDE_DISTORTOS_IDLEHOOK_H_ */
@@ -0,0 +1,268 @@
+/**
+ * \file
+ * \brief TlsfHeap class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
+
+#include "distortos/statistics.hpp"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include <array>
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief TlsfHeap class is a Two-Level Segregated Fit allocator.
+ *
+ * Free blocks are kept on segregated lists - first level splits sizes into power-of-two ranges, second level splits
+ * each of these ranges linearly. Non-empty lists are marked in bitmaps, so a suitable free block is found with a few
+ * bit-scan instructions. Adjacent free blocks are always merged. Therefore allocation, aligned allocation,
+ * deallocation and resizing in place take bounded time, which does not depend on the number of blocks.
+ *
+ * This class does no locking - all calls must be serialized by the user.
+ */
+
+class TlsfHeap
+{
+public:
+
+	/**
+	 * \brief TlsfHeap's constructor
+	 *
+	 * Heap is empty until initialize() is called.
+	 */
+
+	constexpr TlsfHeap() :
+			freeLists_{},
+			secondLevelBitmaps_{},
+			firstLevelBitmap_{},
+			size_{},
+			usedSize_{},
+			peakUsedSize_{},
+			freeSize_{},
+			usedBlocks_{},
+			freeBlocks_{}
+	{
+
+	}
+
+	/**
+	 * \brief Allocates memory.
+	 *
+	 * \param [in] size is the requested size of memory, bytes
+	 *
+	 * \return pointer to allocated memory aligned to alignof(std::max_align_t), nullptr if allocation failed
+	 */
+
+	void* allocate(size_t size);
+
+	/**
+	 * \brief Allocates memory with given alignment.
+	 *
+	 * \param [in] alignment is the requested alignment of memory, bytes, must be a power of 2
+	 * \param [in] size is the requested size of memory, bytes
+	 *
+	 * \return pointer to allocated memory aligned to \a alignment, nullptr if allocation failed or \a alignment is not
+	 * a power of 2
+	 */
+
+	void* allocateAligned(size_t alignment, size_t size);
+
+	/**
+	 * \brief Deallocates memory.
+	 *
+	 * \param [in] memory is a pointer to memory allocated from this heap, nullptr is ignored
+	 */
+
+	void deallocate(void* memory);
+
+	/**
+	 * \return statistics of the heap, all values are 0 if heap was not initialized
+	 */
+
+	statistics::HeapStatistics getStatistics() const;
+
+	/**
+	 * \param [in] memory is a pointer to memory allocated from this heap
+	 *
+	 * \return usable size of \a memory, bytes, not less than the size requested during allocation
+	 */
+
+	static size_t getUsableSize(const void* memory);
+
+	/**
+	 * \brief Initializes the heap with given memory region.
+	 *
+	 * Previous contents of the heap are discarded.
+	 *
+	 * \param [in] memory is a pointer to beginning of memory region
+	 * \param [in] size is the size of memory region, bytes
+	 *
+	 * \return true if heap was initialized, false if memory region is too small
+	 */
+
+	bool initialize(void* memory, size_t size);
+
+	/**
+	 * \return true if heap was initialized, false otherwise
+	 */
+
+	bool isInitialized() const
+	{
+		return size_ != 0;
+	}
+
+	/**
+	 * \brief Resizes allocated memory in place.
+	 *
+	 * Shrinking always succeeds. Growing succeeds only if the block directly following \a memory is free and large
+	 * enough. Contents of memory are not modified.
+	 *
+	 * \param [in] memory is a pointer to memory allocated from this heap
+	 * \param [in] size is the new requested size of memory, bytes
+	 *
+	 * \return true if \a memory was resized, false otherwise (\a memory is not changed in that case)
+	 */
+
+	bool resize(void* memory, size_t size);
+
+	TlsfHeap(const TlsfHeap&) = delete;
+	TlsfHeap(TlsfHeap&&) = delete;
+	const TlsfHeap& operator=(const TlsfHeap&) = delete;
+	TlsfHeap& operator=(TlsfHeap&&) = delete;
+
+private:
+
+	struct Block;
+
+	/// alignment of all blocks, bytes
+	constexpr static size_t alignment_ {alignof(std::max_align_t)};
+
+	/// log2 of number of second-level lists for each first-level range
+	constexpr static size_t secondLevelCountLog2_ {4};
+
+	/// number of second-level lists for each first-level range
+	constexpr static size_t secondLevelCount_ {1 << secondLevelCountLog2_};
+
+	/// log2 of the first size which is not supported - blocks must be smaller than 1 GiB
+	constexpr static size_t firstLevelIndexMax_ {30};
+
+	/// log2 of the smallest size handled by first-level range 1, smaller sizes are all handled by range 0
+	constexpr static size_t firstLevelShift_ {secondLevelCountLog2_ + __builtin_ctz(alignment_)};
+
+	/// number of first-level ranges
+	constexpr static size_t firstLevelCount_ {firstLevelIndexMax_ - firstLevelShift_ + 1};
+
+	/**
+	 * \brief Finds a free block with at least given size and removes it from free lists.
+	 *
+	 * \param [in] size is the required size of block, bytes
+	 *
+	 * \return pointer to found block, nullptr if there is no such block
+	 */
+
+	Block* findFreeBlock(size_t size);
+
+	/**
+	 * \brief Converts size of block to indexes of free list which holds blocks of that size.
+	 *
+	 * \param [in] size is the size of block, bytes, must be less than 2^firstLevelIndexMax_
+	 *
+	 * \return pair with first-level index and second-level index
+	 */
+
+	static std::pair<size_t, size_t> getIndexes(size_t size);
+
+	/**
+	 * \brief Inserts free block to free lists.
+	 *
+	 * \param [in] block is a reference to block which will be inserted, it must not be adjacent to another free block
+	 */
+
+	void insertFreeBlock(Block& block);
+
+	/**
+	 * \brief Marks block as allocated and trims its unused part.
+	 *
+	 * \param [in] block is a reference to block which will be allocated, it must not be on free lists
+	 * \param [in] size is the required size of block, bytes
+	 *
+	 * \return pointer to payload of \a block
+	 */
+
+	void* prepareUsedBlock(Block& block, size_t size);
+
+	/**
+	 * \brief Releases block - merges it with adjacent free blocks and inserts the result to free lists.
+	 *
+	 * \param [in] block is a reference to block which will be released, it must not be on free lists
+	 */
+
+	void releaseBlock(Block& block);
+
+	/**
+	 * \brief Removes free block from free lists.
+	 *
+	 * \param [in] block is a reference to block which will be removed
+	 */
+
+	void removeFreeBlock(Block& block);
+
+	/**
+	 * \brief Splits unused part of block and releases it if it is large enough to form another block.
+	 *
+	 * \param [in] block is a reference to block which will be trimmed, it must not be on free lists
+	 * \param [in] size is the required size of block, bytes
+	 */
+
+	void trimBlock(Block& block, size_t size);
+
+	/// array with heads of free lists, indexed with first-level and second-level indexes
+	std::array<std::array<Block*, secondLevelCount_>, firstLevelCount_> freeLists_;
+
+	/// array with bitmaps of non-empty second-level lists for each first-level range
+	std::array<uint32_t, firstLevelCount_> secondLevelBitmaps_;
+
+	/// bitmap of first-level ranges with at least one non-empty second-level list
+	uint32_t firstLevelBitmap_;
+
+	/// size of the heap available for allocations when it is empty, bytes, 0 if heap was not initialized
+	size_t size_;
+
+	/// sum of sizes of all allocated blocks, bytes
+	size_t usedSize_;
+
+	/// the highest value of \a usedSize_, bytes
+	size_t peakUsedSize_;
+
+	/// sum of sizes of all free blocks, bytes
+	size_t freeSize_;
+
+	/// number of allocated blocks
+	size_t usedBlocks_;
+
+	/// number of free blocks
+	size_t freeBlocks_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_TLSFHEAP_HPP_
@@ -0,0 +1,60 @@
+/**
+ * \file
+ * \brief memoryPoolDeleter() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYPOOLDELETER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYPOOLDELETER_HPP_
+
+#include "distortos/RawMemoryPool.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Templated deleter that can be used with std::unique_ptr and storage allocated from memory pool.
+ *
+ * Counterpart of storageDeleter() for storage allocated with RawMemoryPool::allocate() (or any other allocating member
+ * function of RawMemoryPool).
+ *
+ * \tparam MemoryPool is the type of \a memoryPool - RawMemoryPool or a class derived from it (for example
+ * StaticRawMemoryPool), template parameter of reference type cannot be converted to reference to base class
+ * \tparam memoryPool is a reference to memory pool from which the storage was allocated, must have static storage
+ * duration
+ * \tparam U is the type of \a storage pointer
+ *
+ * \param [in] storage is a pointer to storage that will be deallocated
+ */
+
+template<typename MemoryPool, MemoryPool& memoryPool, typename U>
+void memoryPoolDeleter(U* const storage)
+{
+	static_assert(std::is_base_of<RawMemoryPool, MemoryPool>::value == true,
+			"internal::memoryPoolDeleter() can be used only with RawMemoryPool or classes derived from it!");
+
+	const auto ret = memoryPool.deallocate(storage);
+	assert(ret == 0 && "Storage was not allocated from this memory pool!");
+	static_cast<void>(ret);	// suppress warning
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_MEMORYPOOLDELETER_HPP_
@@ -0,0 +1,190 @@
+/**
+ * \file
+ * \brief CpuLoadMeter class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPULOADMETER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPULOADMETER_HPP_
+
+#include <array>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief CpuLoadMeter class measures CPU load in a sliding window of recent periods.
+ *
+ * Time is measured in ticks, each tick is classified as either idle (idle thread was running) or busy. Time is divided
+ * into consecutive periods of equal length, the number of idle ticks in each of \a Periods most recent completed
+ * periods is recorded in a ring buffer. CPU load may be computed over any number of most recent completed periods, so
+ * one instance provides both short-term and long-term measurements.
+ *
+ * As ticks are just sampled, the measurement is statistical - its resolution is one tick, not core clock cycle. The
+ * advantage is that it doesn't depend on core cycle counter, which on many chips doesn't count when the core sleeps.
+ *
+ * \tparam Periods is the number of recorded completed periods
+ * \tparam PeriodLength is the length of one period, ticks
+ */
+
+template<size_t Periods, uint32_t PeriodLength>
+class CpuLoadMeter
+{
+public:
+
+	static_assert(Periods != 0, "Number of periods must not be zero!");
+	static_assert(PeriodLength != 0, "Length of period must not be zero!");
+
+	/// number of recorded completed periods
+	constexpr static size_t periods {Periods};
+
+	/// length of one period, ticks
+	constexpr static uint32_t periodLength {PeriodLength};
+
+	/**
+	 * \brief CpuLoadMeter's constructor
+	 */
+
+	constexpr CpuLoadMeter() :
+			history_{},
+			idleTicks_{},
+			ticks_{},
+			completedPeriods_{},
+			index_{},
+			periodIdleTicks_{},
+			periodTicks_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds ticks to the measurement.
+	 *
+	 * \param [in] ticks is the number of added ticks
+	 * \param [in] idle selects whether added ticks are idle (true) or busy (false)
+	 */
+
+	void add(const uint64_t ticks, const bool idle)
+	{
+		ticks_ += ticks;
+		if (idle == true)
+			idleTicks_ += ticks;
+
+		const uint32_t remainingTicks = PeriodLength - periodTicks_;
+		if (ticks < remainingTicks)
+		{
+			periodTicks_ += ticks;
+			if (idle == true)
+				periodIdleTicks_ += ticks;
+			return;
+		}
+
+		completePeriod(periodIdleTicks_ + (idle == true ? remainingTicks : 0));
+
+		// periods older than the whole history don't need to be recorded
+		const auto leftTicks = ticks - remainingTicks;
+		const auto fullPeriods = leftTicks / PeriodLength;
+		for (uint64_t i {}; i < fullPeriods && i < Periods; ++i)
+			completePeriod(idle == true ? PeriodLength : 0);
+
+		periodTicks_ = leftTicks % PeriodLength;
+		periodIdleTicks_ = idle == true ? periodTicks_ : 0;
+	}
+
+	/**
+	 * \return total number of idle ticks since the start of measurement
+	 */
+
+	uint64_t getIdleTicks() const
+	{
+		return idleTicks_;
+	}
+
+	/**
+	 * \brief Computes CPU load over most recent completed periods.
+	 *
+	 * \param [in] lastPeriods is the number of most recent completed periods over which CPU load is computed, values
+	 * greater than the number of recorded completed periods are limited to this number
+	 *
+	 * \return CPU load over \a lastPeriods most recent completed periods, 0.1 % units - 0 (idle) to 1000 (fully
+	 * loaded), 0 if there are no completed periods or \a lastPeriods is 0
+	 */
+
+	uint16_t getLoad(size_t lastPeriods) const
+	{
+		if (lastPeriods > completedPeriods_)
+			lastPeriods = completedPeriods_;
+		if (lastPeriods == 0)
+			return {};
+
+		uint64_t idleTicks {};
+		for (size_t i {}; i < lastPeriods; ++i)
+			idleTicks += history_[(index_ + Periods - 1 - i) % Periods];
+
+		const auto ticks = static_cast<uint64_t>(lastPeriods) * PeriodLength;
+		return (ticks - idleTicks) * 1000 / ticks;
+	}
+
+	/**
+	 * \return total number of ticks since the start of measurement
+	 */
+
+	uint64_t getTicks() const
+	{
+		return ticks_;
+	}
+
+private:
+
+	/**
+	 * \brief Records completed period in the ring buffer.
+	 *
+	 * \param [in] idleTicks is the number of idle ticks in completed period
+	 */
+
+	void completePeriod(const uint32_t idleTicks)
+	{
+		history_[index_] = idleTicks;
+		index_ = (index_ + 1) % Periods;
+		if (completedPeriods_ < Periods)
+			++completedPeriods_;
+	}
+
+	/// ring buffer with numbers of idle ticks in recorded completed periods
+	std::array<uint32_t, Periods> history_;
+
+	/// total number of idle ticks since the start of measurement
+	uint64_t idleTicks_;
+
+	/// total number of ticks since the start of measurement
+	uint64_t ticks_;
+
+	/// number of recorded completed periods, saturates at \a Periods
+	size_t completedPeriods_;
+
+	/// index of element of ring buffer which will be written next
+	size_t index_;
+
+	/// number of idle ticks in current period
+	uint32_t periodIdleTicks_;
+
+	/// number of ticks in current period
+	uint32_t periodTicks_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPULOADMETER_HPP_
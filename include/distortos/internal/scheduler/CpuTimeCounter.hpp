@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \brief CpuTimeCounter class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUTIMECOUNTER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUTIMECOUNTER_HPP_
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief CpuTimeCounter class measures periods between consecutive samples of core cycle counter.
+ *
+ * 32-bit value of core cycle counter returned by architecture::getCycleCount() is extended to 64 bits. The counter must
+ * be sampled at least once per its overflow period (2^32 core clock cycles), otherwise the measured periods are too
+ * short.
+ */
+
+class CpuTimeCounter
+{
+public:
+
+	/**
+	 * \brief CpuTimeCounter's constructor
+	 */
+
+	constexpr CpuTimeCounter() :
+			cycleCount_{},
+			lastSample_{}
+	{
+
+	}
+
+	/**
+	 * \return 64-bit number of core clock cycles since core cycle counter was started
+	 */
+
+	uint64_t getCycleCount() const
+	{
+		return cycleCount_ + getElapsed();
+	}
+
+	/**
+	 * \return number of core clock cycles since last call to sample()
+	 */
+
+	uint32_t getElapsed() const
+	{
+		return architecture::getCycleCount() - lastSample_;
+	}
+
+	/**
+	 * \brief Samples core cycle counter.
+	 *
+	 * \return number of core clock cycles since previous call to sample()
+	 */
+
+	uint32_t sample()
+	{
+		const auto cycleCount = architecture::getCycleCount();
+		const uint32_t elapsed = cycleCount - lastSample_;
+		lastSample_ = cycleCount;
+		cycleCount_ += elapsed;
+		return elapsed;
+	}
+
+private:
+
+	/// 64-bit number of core clock cycles at the time of last sample
+	uint64_t cycleCount_;
+
+	/// value of core cycle counter at the time of last sample
+	uint32_t lastSample_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_CPUTIMECOUNTER_HPP_
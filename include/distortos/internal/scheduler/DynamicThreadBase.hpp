@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadBase class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,6 +19,8 @@
 
 #include "distortos/internal/scheduler/ThreadCommon.hpp"
 
+#include "estd/InplaceFunction.hpp"
+
 #include <functional>
 
 namespace distortos
@@ -34,8 +36,11 @@ namespace internal
 {
 
 /**
- * \brief DynamicThreadBase class is a type-erased interface for thread that has dynamic storage for bound function,
- * stack and - if signals are enabled - internal DynamicSignalsReceiver object.
+ * \brief DynamicThreadBase class is a type-erased interface for thread that has dynamic storage for stack and - if
+ * signals are enabled - internal DynamicSignalsReceiver object.
+ *
+ * Bound function (together with its arguments) is stored in the object, so it must fit in
+ * DISTORTOS_BOUND_FUNCTION_STORAGE_SIZE bytes.
  *
  * If thread detachment is enabled (DISTORTOS_THREAD_DETACH_ENABLE is defined) then this class is dynamically allocated
  * by DynamicThread - which allows it to be "detached". Otherwise - if thread detachment is disabled
@@ -115,7 +120,7 @@ public:
 					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
 					std::forward<Function>(function), std::forward<Args>(args)...}
 	{
-
+		setStackPaintSize(parameters.stackPaintSize);
 	}
 
 #endif	// DISTORTOS_THREAD_DETACH_ENABLE != 1
@@ -223,7 +228,7 @@ private:
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
 	/// bound function object
-	std::function<void()> boundFunction_;
+	estd::InplaceFunction<void(), DISTORTOS_BOUND_FUNCTION_STORAGE_SIZE> boundFunction_;
 
 #if DISTORTOS_THREAD_DETACH_ENABLE == 1
 
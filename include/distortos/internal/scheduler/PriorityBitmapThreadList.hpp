@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief PriorityBitmapThreadList class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAPTHREADLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAPTHREADLIST_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief PriorityBitmapThreadList class is a ThreadList with constant-time insertion.
+ *
+ * The elements are kept on a single list sorted by effective priority in descending order - exactly like in ThreadList
+ * - so iteration, begin() and iterators work in the same way. Additionally each group of threads with the same
+ * effective priority is tracked with a pointer to its last element and a 256-bit occupancy bitmap. Insert position of
+ * new element is found with two "count leading zeros" operations on the bitmap, so insertion, removal and finding the
+ * highest priority element take constant time, regardless of the number of elements on the list. Threads with the same
+ * effective priority are kept in FIFO order. When SchedulingPolicy::deadline is enabled, threads with the same
+ * effective priority are additionally sorted by deadline - linking of thread with a deadline requires a linear search
+ * within its group, linking of other threads still takes constant time.
+ *
+ * \warning All modifications of the list must be done through the functions of this class - using functions of
+ * ThreadList (e.g. splicing an element to another list) would leave the bitmap in inconsistent state.
+ */
+
+class PriorityBitmapThreadList : public ThreadList
+{
+public:
+
+	/**
+	 * \brief PriorityBitmapThreadList's constructor
+	 */
+
+	constexpr PriorityBitmapThreadList() :
+			ThreadList{},
+			tails_{},
+			bitmap_{},
+			summary_{}
+	{
+
+	}
+
+	/**
+	 * \brief Unlinks the element at \a position from the list.
+	 *
+	 * \param [in] position is an iterator of the element that will be unlinked from the list
+	 *
+	 * \return iterator of the element that was following the element which was unlinked
+	 */
+
+	iterator erase(iterator position);
+
+	/**
+	 * \brief Links the element in the list, keeping it sorted.
+	 *
+	 * The element is placed at the tail of the group of threads with the same effective priority.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insert(reference newElement);
+
+	/**
+	 * \brief Repositions the element on the list after change of its effective priority.
+	 *
+	 * \param [in] position is an iterator of the element that will be repositioned, it must be linked in this list
+	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
+	 * priority is raised!):
+	 * - true - the element is moved to the head of the group of threads with the new priority,
+	 * - false - the element is moved to the tail of the group of threads with the new priority.
+	 */
+
+	void reposition(iterator position, bool loweringBefore);
+
+	/**
+	 * \brief Transfers the element from another list (or from this list) to this one, keeping it sorted.
+	 *
+	 * The element is placed at the tail of the group of threads with the same effective priority, so splicing an
+	 * element which is already linked in this list can be used to implement round-robin scheduling.
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced to this list
+	 */
+
+	void splice(iterator splicedElement);
+
+	void clear() = delete;
+	void pop_back() = delete;
+	void pop_front() = delete;
+	void swap(ThreadList&) = delete;
+
+private:
+
+	/// number of 32-bit words in the bitmap
+	constexpr static size_t bitmapWords {(UINT8_MAX + 1) / 32};
+
+	/**
+	 * \brief Finds the lowest occupied priority which is greater than or equal to \a priority.
+	 *
+	 * \param [in] priority is the priority from which the search is started
+	 *
+	 * \return lowest occupied priority which is greater than or equal to \a priority, -1 if there is no such priority
+	 */
+
+	int findOccupied(uint8_t priority) const;
+
+	/**
+	 * \brief Links the element in the list at the position selected by its effective priority.
+	 *
+	 * \pre \a newElement is not linked in this list.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 * \param [in] front selects the position of the element in the group of threads with the same effective priority:
+	 * - true - head of the group,
+	 * - false - tail of the group.
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator link(reference newElement, bool front);
+
+	/**
+	 * \brief Updates the bitmap and pointers to last elements of groups before the element is unlinked from the list.
+	 *
+	 * If the element is not linked in this list, nothing is done.
+	 *
+	 * \param [in] element is a reference to the element that will be unlinked from the list
+	 */
+
+	void unindex(reference element);
+
+	/// pointers to last elements of groups of threads with the same effective priority, nullptr if the group is empty
+	std::array<ThreadControlBlock*, UINT8_MAX + 1> tails_;
+
+	/// occupancy bitmap, priority p is represented by bit (31 - p % 32) of word p / 32
+	std::array<uint32_t, bitmapWords> bitmap_;
+
+	/// summary of occupancy bitmap, non-empty word w is represented by bit (31 - w)
+	uint32_t summary_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_PRIORITYBITMAPTHREADLIST_HPP_
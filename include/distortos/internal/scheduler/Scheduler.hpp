@@ -2,7 +2,7 @@
  * \file
  * \brief Scheduler class header
  *
- * \author Copyright (C) 2014-2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,9 +13,32 @@
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
-#include "distortos/internal/scheduler/ThreadList.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#include "distortos/internal/scheduler/CpuTimeCounter.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#include "distortos/internal/scheduler/CpuLoadMeter.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+#include "distortos/internal/scheduler/PriorityBitmapThreadList.hpp"
+
+#else	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
 namespace distortos
 {
 
@@ -38,6 +61,15 @@ public:
 			softwareTimerSupervisor_{},
 			contextSwitchCount_{},
 			tickCount_{}
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+			, cpuTimeCounter_{}
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+			, deadlineMissCount_{}
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+			, cpuLoadMeter_{}
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
 	{
 
 	}
@@ -119,6 +151,31 @@ public:
 
 	uint64_t getContextSwitchCount() const;
 
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+	/**
+	 * \param [in] periods is the number of most recent completed measurement periods over which CPU load is computed
+	 *
+	 * \return CPU load over \a periods most recent completed measurement periods, 0.1 % units - 0 (idle) to 1000 (fully
+	 * loaded)
+	 */
+
+	uint16_t getCpuLoad(size_t periods) const;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread
+	 *
+	 * \return CPU time of thread (including current period of execution if it is currently active), core clock cycles
+	 */
+
+	uint64_t getCpuTime(const ThreadControlBlock& threadControlBlock) const;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
 	/**
 	 * \return reference to currently active ThreadControlBlock
 	 */
@@ -128,6 +185,49 @@ public:
 		return *currentThreadControlBlock_;
 	}
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \return total number of missed deadlines of all threads
+	 */
+
+	uint64_t getDeadlineMissCount() const;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \return total time since start of CPU time accounting, core clock cycles
+	 */
+
+	uint64_t getCycleCount() const;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+	/**
+	 * \return total number of ticks during which idle thread was running
+	 */
+
+	uint64_t getIdleTickCount() const;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+	/**
+	 * \return reference to "runnable" list
+	 */
+
+	PriorityBitmapThreadList& getRunnableList()
+	{
+		return runnableList_;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
 	/**
 	 * \return reference to internal SoftwareTimerSupervisor object
 	 */
@@ -191,6 +291,22 @@ public:
 
 	int remove();
 
+	/**
+	 * \brief Moves blocked thread to another list, without unblocking it.
+	 *
+	 * Thread's state is changed to \a state. Unblock functor of the thread is preserved and will be executed when the
+	 * thread is finally unblocked from \a container. The timeout of blockUntil() (if any) used to block the thread will
+	 * no longer unblock it.
+	 *
+	 * \note This function must be called with masked interrupts.
+	 *
+	 * \param [in] iterator is the iterator to the blocked thread that will be moved
+	 * \param [in] container is a reference to destination list
+	 * \param [in] state is the new state of thread
+	 */
+
+	void requeue(ThreadList::iterator iterator, ThreadList& container, ThreadState state);
+
 	/**
 	 * \brief Resumes suspended thread.
 	 *
@@ -204,6 +320,24 @@ public:
 
 	int resume(ThreadList::iterator iterator);
 
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+	/**
+	 * \brief Suppresses "tick" interrupts until the nearest time point of software timers and puts the core to sleep.
+	 *
+	 * Nothing is done if current thread is not the only runnable thread or if the nearest software timer must be
+	 * executed in the next "tick" interrupt. Otherwise architecture::suppressTicks() is called and the ticks which
+	 * elapsed without "tick" interrupt are added to tick count, so that TickClock::now() stays monotonic. The tick
+	 * timer is stopped for a short moment during reprogramming, so each suppressed period may delay tick boundaries by
+	 * up to architecture-specific number of core cycles - see architecture::suppressTicks().
+	 *
+	 * \note this must be called only by idle thread
+	 */
+
+	void suppressTicks();
+
+#endif	// DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
 	/**
 	 * \brief Suspends current thread.
 	 *
@@ -305,6 +439,18 @@ private:
 	int blockInternal(ThreadList& container, ThreadList::iterator iterator, ThreadState state,
 			const UnblockFunctor* unblockFunctor);
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \brief Checks whether deadline of thread was missed and updates the total number of missed deadlines.
+	 *
+	 * \param [in] threadControlBlock is a reference to checked ThreadControlBlock object
+	 */
+
+	void checkDeadline(ThreadControlBlock& threadControlBlock);
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \brief Tests whether context switch is required or not.
 	 *
@@ -335,9 +481,19 @@ private:
 	/// iterator to the currently active ThreadControlBlock
 	ThreadList::iterator currentThreadControlBlock_;
 
+#if DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order, with priority
+	/// bitmap
+	PriorityBitmapThreadList runnableList_;
+
+#else	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
 	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order
 	ThreadList runnableList_;
 
+#endif	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE != 1
+
 	/// list of ThreadControlBlock elements in "suspended" state, sorted by priority in descending order
 	ThreadList suspendedList_;
 
@@ -349,6 +505,27 @@ private:
 
 	/// tick count
 	uint64_t tickCount_;
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/// counter of core clock cycles used for CPU time accounting
+	CpuTimeCounter cpuTimeCounter_;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/// total number of missed deadlines of all threads
+	uint64_t deadlineMissCount_;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+	/// meter of CPU load, fed with ticks classified as idle or busy
+	CpuLoadMeter<DISTORTOS_SCHEDULER_CPU_LOAD_PERIODS, DISTORTOS_SCHEDULER_CPU_LOAD_PERIOD> cpuLoadMeter_;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
 };
 
 }	// namespace internal
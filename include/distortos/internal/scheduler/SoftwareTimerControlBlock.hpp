@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -44,6 +46,9 @@ public:
 			period_{},
 			functionRunner_{functionRunner},
 			owner_{owner}
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+			, deferred_{true}
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
 	{
 
 	}
@@ -59,6 +64,20 @@ public:
 		stop();
 	}
 
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/**
+	 * \return true if software timer's function is executed in timer service thread, false if it is executed in
+	 * interrupt context
+	 */
+
+	bool isDeferred() const
+	{
+		return deferred_;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
 	/**
 	 * \return true if the timer is running, false otherwise
 	 */
@@ -72,13 +91,33 @@ public:
 	/**
 	 * \brief Runs software timer's function.
 	 *
-	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler()
+	 * If software timer is deferred, its function is executed with interrupt masking disabled.
+	 *
+	 * \note this should only be called by SoftwareTimerSupervisor::tickInterruptHandler() or by
+	 * SoftwareTimerSupervisor::executeDeferred()
 	 *
 	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor that manages this object
 	 */
 
 	void run(SoftwareTimerSupervisor& supervisor);
 
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/**
+	 * \brief Selects context in which software timer's function is executed.
+	 *
+	 * \param [in] deferred selects the context of software timer's function:
+	 * - true - timer service thread (default),
+	 * - false - interrupt context;
+	 */
+
+	void setDeferred(const bool deferred)
+	{
+		deferred_ = deferred;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
 	/**
 	 * \brief Starts the timer.
 	 *
@@ -126,6 +165,14 @@ private:
 
 	/// reference to SoftwareTimer object that owns this SoftwareTimerControlBlock
 	SoftwareTimer& owner_;
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/// true if software timer's function is executed in timer service thread, false if it is executed in interrupt
+	/// context
+	bool deferred_;
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
 };
 
 }	// namespace internal
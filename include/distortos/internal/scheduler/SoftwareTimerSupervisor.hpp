@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerSupervisor class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,24 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE == 1
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#else	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
 #include "distortos/internal/scheduler/SoftwareTimerList.hpp"
 
+#endif	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+#include "distortos/Semaphore.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
 namespace distortos
 {
 
@@ -30,7 +46,15 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
+#if DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE == 1
+			activeWheel_{}
+#else	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
 			activeList_{}
+#endif	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+			, deferredList_{},
+			deferredSemaphore_{0, 1}
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
 	{
 
 	}
@@ -43,6 +67,24 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/**
+	 * \brief Waits for deferred software timers and executes all of them.
+	 *
+	 * \note this must not be called by user code, it is used only by timer service thread
+	 */
+
+	void executeDeferred();
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/**
+	 * \return time point of the nearest software timer, TickClock::time_point::max() if no software timer is active
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
@@ -55,8 +97,38 @@ public:
 
 private:
 
+	/**
+	 * \brief Executes software timer which reached its time point.
+	 *
+	 * If timer service thread is enabled and software timer is deferred, it is only linked in the list of deferred
+	 * software timers and timer service thread is woken up. Otherwise software timer is executed directly.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer that will be executed
+	 */
+
+	void execute(SoftwareTimerControlBlock& softwareTimer);
+
+#if DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE == 1
+
+	/// timing wheel of active software timers (waiting for execution)
+	SoftwareTimerWheel activeWheel_;
+
+#else	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerList activeList_;
+
+#endif	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	/// list of deferred software timers (waiting for execution in timer service thread)
+	estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock> deferredList_;
+
+	/// semaphore used to wake up timer service thread
+	Semaphore deferredSemaphore_;
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
 };
 
 }	// namespace internal
@@ -0,0 +1,158 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+
+#include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SoftwareTimerControlBlock;
+
+/**
+ * \brief SoftwareTimerWheel class is a hierarchical timing wheel of software timers (software timer control blocks).
+ *
+ * The wheel has \a levels levels, each with \a slots slots, which cover consecutive groups of \a levelBits bits of
+ * expiration time point. Software timer is linked in the level selected by the most significant group of bits in which
+ * its expiration time point differs from current time point of the wheel, and in the slot selected by the value of this
+ * group in its expiration time point. Software timers which are too far in the future are linked in "overflow" list.
+ * Starting (insertion) and stopping (unlinking) of software timer takes constant time. Each time the wheel reaches the
+ * beginning of an occupied slot, the slot is emptied and its software timers are moved to lower levels ("cascaded") or
+ * to the list of expired software timers. Time points at which nothing happens are skipped using occupancy bitmaps of
+ * levels, so the cost of advancing the wheel doesn't depend on the length of advanced period.
+ *
+ * The list of expired software timers is sorted by expiration time point, with software timers with equal time points
+ * kept in the order of insertion - this is exactly the same order as the one provided by SoftwareTimerList.
+ */
+
+class SoftwareTimerWheel
+{
+public:
+
+	/// unsorted intrusive list of software timers (software timer control blocks)
+	using List = estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
+
+	/// number of bits of expiration time point covered by one level
+	constexpr static size_t levelBits {5};
+
+	/// number of slots in one level
+	constexpr static size_t slots {1 << levelBits};
+
+	/// number of levels
+	constexpr static size_t levels {4};
+
+	/**
+	 * \brief SoftwareTimerWheel's constructor
+	 */
+
+	constexpr SoftwareTimerWheel() :
+			// slots_ is default-initialized, as value-initialization of nested arrays of lists is not constexpr
+			overflowList_{},
+			expiredList_{},
+			bitmaps_{},
+			timePoint_{}
+	{
+
+	}
+
+	/**
+	 * \brief Advances current time point of the wheel.
+	 *
+	 * All software timers which reach their expiration time points are moved to the list of expired software timers.
+	 *
+	 * \param [in] timePoint is the new time point of the wheel, must not be less than current time point of the wheel
+	 */
+
+	void advance(TickClock::time_point timePoint);
+
+	/**
+	 * \return reference to list of expired software timers, sorted by expiration time point
+	 */
+
+	List& getExpiredList()
+	{
+		return expiredList_;
+	}
+
+	/**
+	 * \return time point of the nearest software timer, TickClock::time_point::max() if the wheel is empty
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
+	/**
+	 * \brief Links software timer in the wheel.
+	 *
+	 * If expiration time point of software timer is not greater than current time point of the wheel, it is linked in
+	 * the list of expired software timers.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer that will be linked
+	 */
+
+	void insert(SoftwareTimerControlBlock& softwareTimer);
+
+private:
+
+	/// unsigned type of time point used for indexing
+	using Ticks = uint64_t;
+
+	/**
+	 * \return time point of the nearest event in the wheel (beginning of occupied slot or "overflow" of the highest
+	 * level), UINT64_MAX if there are no events
+	 */
+
+	Ticks getNextEvent() const;
+
+	/**
+	 * \brief Links software timer in the list of expired software timers, keeping it sorted.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer that will be linked
+	 */
+
+	void insertExpired(SoftwareTimerControlBlock& softwareTimer);
+
+	/**
+	 * \brief Moves all software timers from the list to proper slots of the wheel or to the list of expired software
+	 * timers.
+	 *
+	 * \param [in] list is a reference to list of software timers that will be moved
+	 */
+
+	void redistribute(List& list);
+
+	/// slots of all levels
+	std::array<std::array<List, slots>, levels> slots_;
+
+	/// list of software timers which are too far in the future for the highest level
+	List overflowList_;
+
+	/// list of expired software timers, sorted by expiration time point
+	List expiredList_;
+
+	/// occupancy bitmaps of levels, slot s is represented by bit s, bits may also be set for slots which were emptied
+	std::array<uint32_t, levels> bitmaps_;
+
+	/// current time point of the wheel
+	TickClock::rep timePoint_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief Stack class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -91,11 +91,24 @@ public:
 	}
 
 	/**
-	 * \return stack's "high water mark" (max usage), excluding "stack guard", bytes
+	 * \brief Gets stack's "high water mark" (max usage).
+	 *
+	 * Only painted area of stack is checked, so if the stack was painted only partially (see setPaintSize()) and all of
+	 * painted area was used, real usage is unknown - in that case the size of painted area (see getPaintedSize()) is
+	 * returned.
+	 *
+	 * \return stack's "high water mark" (max usage), excluding "stack guard" and limited to painted area, bytes
 	 */
 
 	size_t getHighWaterMark() const;
 
+	/**
+	 * \return size of area of the stack which is painted with stack sentinel by initialize(), excluding "stack guard",
+	 * bytes
+	 */
+
+	size_t getPaintedSize() const;
+
 	/**
 	 * \return adjusted size of stack's storage, excluding "stack guard", bytes
 	 */
@@ -105,6 +118,15 @@ public:
 		return adjustedSize_ > stackGuardSize ? adjustedSize_ - stackGuardSize : 0;
 	}
 
+	/**
+	 * \return pointer to beginning of "stack guard"
+	 */
+
+	const void* getStackGuard() const
+	{
+		return adjustedStorage_;
+	}
+
 	/**
 	 * \brief Gets current value of stack pointer.
 	 *
@@ -117,7 +139,8 @@ public:
 	}
 
 	/**
-	 * \brief Fills the stack with stack sentinel, initializes its contents and stack pointer value.
+	 * \brief Fills "stack guard" and painted area of the stack with stack sentinel, initializes its contents and
+	 * stack pointer value.
 	 *
 	 * \param [in] runnableThread is a reference to RunnableThread object that is being run
 	 *
@@ -127,6 +150,22 @@ public:
 
 	int initialize(RunnableThread& runnableThread);
 
+	/**
+	 * \brief Sets size of area of the stack which is painted with stack sentinel by initialize().
+	 *
+	 * Painting of the whole stack is required for getHighWaterMark() to work for any usage, but for large stacks it
+	 * dominates the time of thread creation. Painted area is at the top (the end which is used first) of the stack.
+	 * "Stack guard" is always painted.
+	 *
+	 * \param [in] paintSize is the size of area of the stack which is painted with stack sentinel, values greater than
+	 * stack's size select painting of the whole stack, 0 selects painting of just the "stack guard"
+	 */
+
+	void setPaintSize(const size_t paintSize)
+	{
+		paintSize_ = paintSize;
+	}
+
 	/**
 	 * \brief Sets value of stack pointer.
 	 *
@@ -154,6 +193,9 @@ private:
 	/// adjusted size of stack's storage
 	const size_t adjustedSize_;
 
+	/// size of area of the stack which is painted with stack sentinel by initialize(), bytes
+	size_t paintSize_;
+
 	/// current value of stack pointer register
 	void* stackPointer_;
 };
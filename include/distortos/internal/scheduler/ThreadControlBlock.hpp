@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -76,6 +76,23 @@ public:
 
 	int addHook();
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \brief Adds period of execution to CPU time of thread.
+	 *
+	 * \attention This function should be called only by Scheduler.
+	 *
+	 * \param [in] cycles is the number of core clock cycles during which the thread was running
+	 */
+
+	void addCpuTime(const uint32_t cycles)
+	{
+		cpuTime_ += cycles;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
 	/**
 	 * \brief Block hook function of thread
 	 *
@@ -91,6 +108,69 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \brief Checks whether deadline of thread was missed.
+	 *
+	 * Each deadline is counted as missed only once.
+	 *
+	 * \param [in] timePoint is the current time point
+	 *
+	 * \return true if deadline of thread was missed and this was not detected earlier, false otherwise
+	 */
+
+	bool checkDeadline(const TickClock::time_point timePoint)
+	{
+		if (deadlineMissed_ == true || timePoint <= deadline_)
+			return false;
+
+		deadlineMissed_ = true;
+		++deadlineMissCount_;
+		return true;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/**
+	 * \return CPU time of thread (without current period of execution), core clock cycles
+	 */
+
+	uint64_t getCpuTime() const
+	{
+		return cpuTime_;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+	/**
+	 * \return number of context switches to this thread
+	 */
+
+	uint64_t getContextSwitchCount() const
+	{
+		return contextSwitchCount_;
+	}
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \return number of missed deadlines of thread
+	 */
+
+	uint32_t getDeadlineMissCount() const
+	{
+		return deadlineMissCount_;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \return pointer to list that has this object
 	 */
@@ -186,6 +266,33 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated, nullptr if it was not added to
+	 * scheduler yet and no group was provided in constructor
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \brief Sets deadline of thread.
+	 *
+	 * The position in the thread list is adjusted and context switch may be requested.
+	 *
+	 * \param [in] deadline is the new absolute deadline of thread
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - thread doesn't use SchedulingPolicy::deadline;
+	 */
+
+	int setDeadline(TickClock::time_point deadline);
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -238,7 +345,8 @@ public:
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
-	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable.
+	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable and - if thread statistics are
+	 * enabled - increments the number of context switches to this thread.
 	 *
 	 * \attention This function should be called only by Scheduler::switchContext().
 	 */
@@ -246,6 +354,12 @@ public:
 	void switchedToHook()
 	{
 		_impure_ptr = &reent_;
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+		++contextSwitchCount_;
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
 	}
 
 	/**
@@ -337,6 +451,30 @@ private:
 
 	/// current state of object
 	ThreadState state_;
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/// CPU time of thread (without current period of execution), core clock cycles
+	uint64_t cpuTime_;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+	/// number of context switches to this thread
+	uint64_t contextSwitchCount_;
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/// number of missed deadlines of thread
+	uint32_t deadlineMissCount_;
+
+	/// true if current deadline of thread was already counted as missed
+	bool deadlineMissed_;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -45,6 +45,23 @@ public:
 
 	void add(ThreadControlBlock& threadControlBlock);
 
+	/**
+	 * \brief Executes provided functor for each thread in this group.
+	 *
+	 * \warning This function must be called with interrupt masking enabled.
+	 *
+	 * \tparam Functor is the type of functor, it should be callable as `void(const ThreadControlBlock&)`
+	 *
+	 * \param [in] functor is the functor which will be executed for each thread in this group
+	 */
+
+	template<typename Functor>
+	void forEach(Functor&& functor) const
+	{
+		for (auto& threadControlBlock : threadList_)
+			functor(threadControlBlock);
+	}
+
 private:
 
 	/// intrusive list of threads (thread control blocks)
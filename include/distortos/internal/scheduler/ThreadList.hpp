@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadList class header
  *
- * \author Copyright (C) 2014-2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -24,7 +24,8 @@ namespace internal
 
 class ThreadControlBlock;
 
-/// functor which gives descending effective priority order of elements on the list
+/// functor which gives descending effective priority order of elements on the list, elements with the same effective
+/// priority are sorted by deadline in ascending order (only when SchedulingPolicy::deadline is enabled)
 struct ThreadDescendingEffectivePriority
 {
 	/**
@@ -42,11 +43,19 @@ struct ThreadDescendingEffectivePriority
 	 * \param [in] left is the object on the left-hand side of comparison
 	 * \param [in] right is the object on the right-hand side of comparison
 	 *
-	 * \return true if left's effective priority is less than right's effective priority
+	 * \return true if left's effective priority is less than right's effective priority (or if they are equal and
+	 * left's deadline is later than right's deadline)
 	 */
 
 	bool operator()(const ThreadListNode& left, const ThreadListNode& right) const
 	{
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+		if (left.getEffectivePriority() == right.getEffectivePriority())
+			return left.getDeadline() > right.getDeadline();
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 		return left.getEffectivePriority() < right.getEffectivePriority();
 	}
 };
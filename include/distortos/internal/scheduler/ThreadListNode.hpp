@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadListNode class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,14 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#include "distortos/TickClock.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 #include "estd/IntrusiveList.hpp"
 
 namespace distortos
@@ -29,6 +37,8 @@ namespace internal
 
 class ThreadListNode
 {
+	friend class PriorityBitmapThreadList;
+
 public:
 
 	/**
@@ -41,11 +51,29 @@ public:
 			threadListNode{},
 			threadGroupNode{},
 			priority_{priority},
-			boostedPriority_{}
+			boostedPriority_{},
+			bucketPriority_{}
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+			, deadline_{TickClock::time_point::max()}
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 	{
 
 	}
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/**
+	 * \return deadline of thread, TickClock::time_point::max() if the thread doesn't use SchedulingPolicy::deadline or
+	 * its deadline was not set
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -77,6 +105,16 @@ protected:
 
 	/// thread's boosted priority, 0 - no boosting
 	uint8_t boostedPriority_;
+
+	/// effective priority with which the thread was linked in PriorityBitmapThreadList
+	uint8_t bucketPriority_;
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	/// thread's deadline, used for ordering of threads with the same effective priority
+	TickClock::time_point deadline_;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 };
 
 }	// namespace internal
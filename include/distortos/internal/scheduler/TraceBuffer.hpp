@@ -0,0 +1,163 @@
+/**
+ * \file
+ * \brief TraceBuffer class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEBUFFER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEBUFFER_HPP_
+
+#include "distortos/internal/scheduler/TraceEventType.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief TraceBuffer class is a ring buffer of fixed-size binary records of kernel events.
+ *
+ * The object has a fixed layout which can be dumped from memory and decoded on host (e.g. with
+ * scripts/traceToChromeJson.py) - a header with magic value, version, size of record, capacity, number of valid records
+ * and index of next record, followed by an array of records. All fields are little-endian on supported targets. When
+ * the buffer is full, the oldest records are overwritten.
+ *
+ * The class does no locking - serialization of accesses is the responsibility of the user.
+ *
+ * \tparam Capacity is the number of records in the buffer
+ */
+
+template<size_t Capacity>
+class TraceBuffer
+{
+public:
+
+	/// Record struct is a binary record of one event
+	struct Record
+	{
+		/// value of core cycle counter at the time of event
+		uint32_t timestamp;
+
+		/// address of object related to the event or a user value
+		uint32_t object;
+
+		/// type of event, TraceEventType
+		uint8_t type;
+
+		/// additional argument of the event, meaning depends on type
+		uint8_t argument;
+
+		/// reserved, always 0
+		uint16_t reserved;
+	};
+
+	static_assert(sizeof(Record) == 12, "Invalid size of TraceBuffer::Record!");
+	static_assert(Capacity > 0, "Capacity of TraceBuffer must not be 0!");
+
+	/// magic value identifying trace buffer in memory dump, "DTRC" when read as little-endian bytes
+	constexpr static uint32_t magic {0x43525444};
+
+	/// version of binary format
+	constexpr static uint16_t version {1};
+
+	/**
+	 * \brief TraceBuffer's constructor
+	 */
+
+	constexpr TraceBuffer() :
+			magic_{magic},
+			version_{version},
+			recordSize_{sizeof(Record)},
+			capacity_{Capacity},
+			count_{},
+			index_{},
+			records_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds new record to the buffer, overwriting the oldest one if the buffer is full.
+	 *
+	 * \param [in] timestamp is the value of core cycle counter at the time of event
+	 * \param [in] type is the type of event
+	 * \param [in] object is the address of object related to the event or a user value
+	 * \param [in] argument is the additional argument of the event
+	 */
+
+	void add(const uint32_t timestamp, const TraceEventType type, const uint32_t object, const uint8_t argument)
+	{
+		records_[index_] = {timestamp, object, static_cast<uint8_t>(type), argument, {}};
+		index_ = index_ + 1 < Capacity ? index_ + 1 : 0;
+		if (count_ < Capacity)
+			++count_;
+	}
+
+	/**
+	 * \return number of valid records in the buffer
+	 */
+
+	uint32_t getCount() const
+	{
+		return count_;
+	}
+
+	/**
+	 * \param [in] index is the index of record, 0 - the oldest valid record, must be less than getCount()
+	 *
+	 * \return const reference to selected record
+	 */
+
+	const Record& getRecord(const size_t index) const
+	{
+		const auto position = index_ + Capacity - count_ + index;
+		return records_[position < Capacity ? position : position - Capacity];
+	}
+
+	/**
+	 * \brief Removes all records from the buffer.
+	 */
+
+	void reset()
+	{
+		count_ = {};
+		index_ = {};
+	}
+
+private:
+
+	/// magic value identifying trace buffer
+	uint32_t magic_;
+
+	/// version of binary format
+	uint16_t version_;
+
+	/// size of one record, bytes
+	uint16_t recordSize_;
+
+	/// number of records in the buffer
+	uint32_t capacity_;
+
+	/// number of valid records in the buffer
+	uint32_t count_;
+
+	/// index of next record which will be written
+	uint32_t index_;
+
+	/// records
+	std::array<Record, Capacity> records_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEBUFFER_HPP_
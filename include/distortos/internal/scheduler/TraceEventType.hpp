@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief TraceEventType enum class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENTTYPE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENTTYPE_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// type of event recorded in trace buffer, numeric values are part of binary format of trace buffer
+enum class TraceEventType : uint8_t
+{
+	/// context switch, object is the thread control block of new thread
+	contextSwitch,
+	/// thread blocked, object is the thread control block, argument is the new ThreadState
+	block,
+	/// thread unblocked, object is the thread control block, argument is UnblockReason
+	unblock,
+	/// mutex locked, object is the mutex control block
+	mutexLock,
+	/// ownership of mutex transferred to unblocked thread, object is the mutex control block
+	mutexTransfer,
+	/// mutex unlocked, object is the mutex control block
+	mutexUnlock,
+	/// element popped from queue, object is the queue
+	queuePop,
+	/// element pushed to queue, object is the queue
+	queuePush,
+	/// software timer expired, object is the software timer control block
+	softwareTimerExpiry,
+	/// user marker, object is the value passed to trace::mark()
+	userMarker,
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENTTYPE_HPP_
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief getIdleThread() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETIDLETHREAD_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETIDLETHREAD_HPP_
+
+namespace distortos
+{
+
+class Thread;
+
+namespace internal
+{
+
+/**
+ * \return reference to idle thread
+ */
+
+Thread& getIdleThread();
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_GETIDLETHREAD_HPP_
@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief traceEvent() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+
+#include "distortos/internal/scheduler/TraceEventType.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#if DISTORTOS_TRACE_ENABLE == 1
+
+/**
+ * \brief Records kernel event in trace buffer.
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is a pointer to object related to the event
+ * \param [in] argument is the additional argument of the event, default - 0
+ */
+
+void traceEvent(TraceEventType type, const void* object, uint8_t argument = {});
+
+#else	// DISTORTOS_TRACE_ENABLE != 1
+
+/**
+ * \brief Records kernel event in trace buffer - empty implementation used when trace is disabled.
+ */
+
+inline void traceEvent(TraceEventType, const void*, uint8_t = {})
+{
+
+}
+
+#endif	// DISTORTOS_TRACE_ENABLE != 1
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
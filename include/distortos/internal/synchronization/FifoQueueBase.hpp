@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class header
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,7 @@
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
 #include <memory>
+#include <utility>
 
 namespace distortos
 {
@@ -68,6 +69,49 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
+	/**
+	 * \brief Finishes the reservation made with reserve(), publishing reserved slot.
+	 *
+	 * Elements are published in the order of their slots, so the element becomes available for popping when all
+	 * outstanding reservations are committed. Elements pushed while reservations are outstanding are also published
+	 * at that time.
+	 *
+	 * \return 0 if reservation was committed successfully, error code otherwise:
+	 * - EPERM - there are no outstanding reservations;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit()
+	{
+		return finish(popSemaphore_, pushReservations_);
+	}
+
+	/**
+	 * \brief Implementation of peek() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] element is a reference to pointer which will be used to return pointer to the oldest element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peek(const SemaphoreFunctor& waitSemaphoreFunctor, void*& element)
+	{
+		return start(waitSemaphoreFunctor, popSemaphore_, readPosition_, popReservations_, element);
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -82,7 +126,28 @@ public:
 
 	int pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
+		return pop(waitSemaphoreFunctor, functor, 1).first;
+	}
+
+	/**
+	 * \brief Implementation of popBatch() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will be
+	 * called once for each popped element and will get readPosition_ as argument
+	 * \param [in] maxCount is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
+			const size_t maxCount)
+	{
+		return popPush(waitSemaphoreFunctor, functor, maxCount, popSemaphore_, pushSemaphore_, readPosition_,
+				popReservations_);
 	}
 
 	/**
@@ -99,31 +164,173 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
+		return push(waitSemaphoreFunctor, functor, 1).first;
+	}
+
+	/**
+	 * \brief Implementation of pushBatch() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will be
+	 * called once for each pushed element and will get writePosition_ as argument
+	 * \param [in] maxCount is the maximum number of pushed elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
+			const size_t maxCount)
+	{
+		return popPush(waitSemaphoreFunctor, functor, maxCount, pushSemaphore_, popSemaphore_, writePosition_,
+				pushReservations_);
+	}
+
+	/**
+	 * \brief Finishes the reservation made with peek(), freeing peeked slot.
+	 *
+	 * Slots are freed in the order of their elements, so the slot becomes available for pushing when all outstanding
+	 * peeks are released. Slots of elements popped while peeks are outstanding are also freed at that time.
+	 *
+	 * \return 0 if peek was released successfully, error code otherwise:
+	 * - EPERM - there are no outstanding peeks;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release()
+	{
+		return finish(pushSemaphore_, popReservations_);
+	}
+
+	/**
+	 * \brief Finishes the reservation made with peek(), freeing peeked slot after executing functor on peeked element.
+	 *
+	 * \param [in] functor is a reference to QueueFunctor which will destroy peeked element - it will be called only if
+	 * there are outstanding peeks, before the slot is freed
+	 * \param [in] element is a pointer to peeked element, which will be passed to \a functor
+	 *
+	 * \return 0 if peek was released successfully, error code otherwise:
+	 * - EPERM - there are no outstanding peeks;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(const QueueFunctor& functor, void* element);
+
+	/**
+	 * \brief Implementation of reserve() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reserve(const SemaphoreFunctor& waitSemaphoreFunctor, void*& slot)
+	{
+		return start(waitSemaphoreFunctor, pushSemaphore_, writePosition_, pushReservations_, slot);
 	}
 
 private:
 
+	/// Reservations struct holds state of reservations of slots on one side of the queue
+	struct Reservations
+	{
+		/// number of outstanding reservations
+		size_t pending;
+
+		/// number of finished operations for which the semaphore of the other side was not posted yet
+		size_t unposted;
+	};
+
+	/**
+	 * \brief Advances position in storage to the next slot, wrapping around at the end of storage.
+	 *
+	 * \param [in,out] storage is a reference to position in storage, \a readPosition_ or \a writePosition_
+	 */
+
+	void advance(void*& storage) const;
+
+	/**
+	 * \brief Finishes the reservation made with start().
+	 *
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted, \a popSemaphore_ for commit(), \a
+	 * pushSemaphore_ for release()
+	 * \param [in] reservations is a reference to state of reservations, \a pushReservations_ for commit(), \a
+	 * popReservations_ for release()
+	 *
+	 * \return 0 if reservation was finished successfully, error code otherwise:
+	 * - EPERM - there are no outstanding reservations;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int finish(Semaphore& postSemaphore, Reservations& reservations);
+
+	/**
+	 * \brief Posts semaphore of the other side of the queue for all finished operations, unless there are outstanding
+	 * reservations.
+	 *
+	 * \note This function must be called with interrupt masking enabled.
+	 *
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted
+	 * \param [in] reservations is a reference to state of reservations
+	 * \param [in] finished is the number of operations finished just now
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int postFinished(Semaphore& postSemaphore, Reservations& reservations, size_t finished);
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased functor
 	 *
+	 * Waits for the first element (or slot) with \a waitSemaphoreFunctor, then transfers as many elements as possible
+	 * without waiting (but no more than \a maxCount). Whole batch is handled in one critical section.
+	 *
 	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
 	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping/pushing - it
-	 * will get \a storage as argument
+	 * will be called once for each element and will get \a storage as argument
+	 * \param [in] maxCount is the maximum number of popped/pushed elements
 	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for pop(), \a
 	 * pushSemaphore_ for push()
 	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
 	 * for pop(), \a popSemaphore_ for push()
 	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
 	 * readPosition_ for pop(), \a writePosition_ for push()
+	 * \param [in] reservations is a reference to state of reservations, \a popReservations_ for pop(), \a
+	 * pushReservations_ for push()
 	 *
-	 * \return 0 if operation was successful, error code otherwise:
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped/pushed elements (valid
+	 * even when error code is returned); error codes:
 	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
-			Semaphore& postSemaphore, void*& storage);
+	std::pair<int, size_t> popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
+			size_t maxCount, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage,
+			Reservations& reservations);
+
+	/**
+	 * \brief Implementation of peek() and reserve()
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for peek(), \a
+	 * pushSemaphore_ for reserve()
+	 * \param [in] storage is a reference to appropriate pointer to storage, \a readPosition_ for peek(), \a
+	 * writePosition_ for reserve()
+	 * \param [in] reservations is a reference to state of reservations, \a popReservations_ for peek(), \a
+	 * pushReservations_ for reserve()
+	 * \param [out] slot is a reference to pointer which will be used to return pointer to reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int start(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& storage,
+			Reservations& reservations, void*& slot);
 
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
@@ -143,6 +350,12 @@ private:
 	/// pointer to first free slot available for writing
 	void* writePosition_;
 
+	/// state of reservations made with peek()
+	Reservations popReservations_;
+
+	/// state of reservations made with reserve()
+	Reservations pushReservations_;
+
 	/// size of single queue element, bytes
 	const size_t elementSize_;
 };
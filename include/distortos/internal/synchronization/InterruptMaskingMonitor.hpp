@@ -0,0 +1,200 @@
+/**
+ * \file
+ * \brief InterruptMaskingMonitor class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_INTERRUPTMASKINGMONITOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_INTERRUPTMASKINGMONITOR_HPP_
+
+#include "distortos/internal/synchronization/getInterruptMaskingMonitor.hpp"
+
+#include "distortos/statistics.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief InterruptMaskingMonitor class records durations of periods during which interrupt masking is enabled.
+ *
+ * Only the outermost InterruptMaskingLock starts and ends a period, nested locks are just counted. If interrupt
+ * masking is temporarily disabled with InterruptUnmaskingLock (e.g. to allow context switch), current period is ended
+ * and a new one is started when interrupt masking is restored. Durations are measured with core cycle counter.
+ *
+ * Member functions (except pause() and resume(), which don't do anything in that case) must be called with interrupt
+ * masking enabled.
+ */
+
+class InterruptMaskingMonitor
+{
+public:
+
+	/// guard used by InterruptMaskingLock - calls enter() in constructor and exit() in destructor
+	class MaskingGuard
+	{
+	public:
+
+		/**
+		 * \brief MaskingGuard's constructor
+		 *
+		 * Never inlined, so its return address is the address of code which constructs InterruptMaskingLock.
+		 */
+
+		__attribute__ ((noinline)) MaskingGuard()
+		{
+			getInterruptMaskingMonitor().enter(__builtin_return_address(0));
+		}
+
+		/**
+		 * \brief MaskingGuard's destructor
+		 */
+
+		~MaskingGuard()
+		{
+			getInterruptMaskingMonitor().exit();
+		}
+
+		MaskingGuard(const MaskingGuard&) = delete;
+		MaskingGuard(MaskingGuard&&) = delete;
+		MaskingGuard& operator=(const MaskingGuard&) = delete;
+		MaskingGuard& operator=(MaskingGuard&&) = delete;
+	};
+
+	/// guard used by InterruptUnmaskingLock - calls pause() in constructor and resume() in destructor
+	class UnmaskingGuard
+	{
+	public:
+
+		/**
+		 * \brief UnmaskingGuard's constructor
+		 */
+
+		UnmaskingGuard() :
+				depth_{getInterruptMaskingMonitor().pause()}
+		{
+
+		}
+
+		/**
+		 * \brief UnmaskingGuard's destructor
+		 *
+		 * Never inlined, so its return address is the address of code which destructs InterruptUnmaskingLock.
+		 */
+
+		__attribute__ ((noinline)) ~UnmaskingGuard()
+		{
+			getInterruptMaskingMonitor().resume(depth_, __builtin_return_address(0));
+		}
+
+		UnmaskingGuard(const UnmaskingGuard&) = delete;
+		UnmaskingGuard(UnmaskingGuard&&) = delete;
+		UnmaskingGuard& operator=(const UnmaskingGuard&) = delete;
+		UnmaskingGuard& operator=(UnmaskingGuard&&) = delete;
+
+	private:
+
+		/// nesting depth of InterruptMaskingLock objects saved in constructor
+		const uint32_t depth_;
+	};
+
+	/**
+	 * \brief InterruptMaskingMonitor's constructor
+	 */
+
+	constexpr InterruptMaskingMonitor() :
+			statistics_{},
+			address_{},
+			depth_{},
+			start_{}
+	{
+
+	}
+
+	/**
+	 * \brief Called after interrupt masking was enabled by InterruptMaskingLock.
+	 *
+	 * If this is the outermost lock, starts new period.
+	 *
+	 * \param [in] address is the address of code which enabled interrupt masking
+	 */
+
+	void enter(const void* address);
+
+	/**
+	 * \brief Called before interrupt masking is restored by InterruptMaskingLock.
+	 *
+	 * If this is the outermost lock, ends current period and records its duration.
+	 */
+
+	void exit();
+
+	/**
+	 * \return statistics of periods during which interrupt masking was enabled
+	 */
+
+	const statistics::InterruptMaskingStatistics& getStatistics() const
+	{
+		return statistics_;
+	}
+
+	/**
+	 * \brief Called before interrupt masking is disabled by InterruptUnmaskingLock.
+	 *
+	 * Ends current period (if any) and records its duration.
+	 *
+	 * \return nesting depth of InterruptMaskingLock objects, which must be passed to matching resume()
+	 */
+
+	uint32_t pause();
+
+	/**
+	 * \brief Resets statistics.
+	 */
+
+	void reset();
+
+	/**
+	 * \brief Called after interrupt masking was restored by InterruptUnmaskingLock.
+	 *
+	 * If interrupt masking was enabled before matching pause(), starts new period.
+	 *
+	 * \param [in] depth is the value returned by matching pause()
+	 * \param [in] address is the address of code which restored interrupt masking
+	 */
+
+	void resume(uint32_t depth, const void* address);
+
+private:
+
+	/**
+	 * \brief Ends current period and records its duration.
+	 */
+
+	void record();
+
+	/// statistics of periods during which interrupt masking was enabled
+	statistics::InterruptMaskingStatistics statistics_;
+
+	/// address of code which started current period
+	const void* address_;
+
+	/// nesting depth of InterruptMaskingLock objects, 0 if interrupt masking is disabled
+	uint32_t depth_;
+
+	/// value of core cycle counter at the beginning of current period
+	uint32_t start_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_INTERRUPTMASKINGMONITOR_HPP_
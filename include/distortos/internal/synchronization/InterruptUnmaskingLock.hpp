@@ -2,7 +2,7 @@
  * \file
  * \brief InterruptUnmaskingLock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,14 @@
 
 #include "distortos/internal/synchronization/InterruptMaskingUnmaskingLock.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#include "distortos/internal/synchronization/InterruptMaskingMonitor.hpp"
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
 namespace distortos
 {
 
@@ -24,9 +32,29 @@ namespace internal
 
 /// InterruptUnmaskingLock class is a RAII wrapper for
 /// architecture::disableInterruptMasking() / architecture::restoreInterruptMasking()
-class InterruptUnmaskingLock : private InterruptMaskingUnmaskingLock<architecture::disableInterruptMasking>
+class InterruptUnmaskingLock :
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+		private InterruptMaskingMonitor::UnmaskingGuard,	// must be constructed before and destructed after the lock
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+		private InterruptMaskingUnmaskingLock<architecture::disableInterruptMasking>
 {
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+public:
+
+	/**
+	 * \brief InterruptUnmaskingLock's destructor
+	 *
+	 * Always inlined, so the address recorded by InterruptMaskingMonitor::UnmaskingGuard is in the code which uses
+	 * this lock.
+	 */
+
+	__attribute__ ((always_inline)) ~InterruptUnmaskingLock()
+	{
+
+	}
 
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,7 +19,9 @@
 
 #include "estd/SortedIntrusiveForwardList.hpp"
 
+#include <array>
 #include <memory>
+#include <utility>
 
 namespace distortos
 {
@@ -111,6 +113,81 @@ public:
 	/// type of free entry list
 	using FreeEntryList = EntryList::UnsortedIntrusiveForwardList;
 
+	/**
+	 * \brief PriorityBuckets class is an index of entry list which makes pushing of elements take constant time.
+	 *
+	 * Entries are still kept on a single list sorted by priority in descending order, but each group of entries with
+	 * the same priority is additionally tracked with a pointer to its last element and a 256-bit occupancy bitmap -
+	 * just like in PriorityBitmapThreadList. Insert position of new entry is found with two "count leading zeros"
+	 * operations on the bitmap instead of a linear search of the list, so pushing and popping take constant time,
+	 * regardless of the number of elements in the queue. Entries with the same priority are kept in FIFO order.
+	 *
+	 * The index requires 1 pointer per each possible priority (1 kB on 32-bit architecture), so it pays off only in
+	 * deep queues with many different priorities.
+	 */
+
+	class PriorityBuckets
+	{
+	public:
+
+		/**
+		 * \brief PriorityBuckets's constructor
+		 */
+
+		constexpr PriorityBuckets() :
+				tails_{},
+				bitmap_{},
+				summary_{}
+		{
+
+		}
+
+		/**
+		 * \brief Updates the index before the first entry is unlinked from entry list.
+		 *
+		 * \param [in] entry is a reference to the first entry of entry list, which will be unlinked
+		 */
+
+		void unlinkFront(const Entry& entry);
+
+		/**
+		 * \brief Splices the entry to entry list, after the last entry with priority higher than or equal to its own.
+		 *
+		 * \param [in] entryList is a reference to entry list to which the entry will be spliced
+		 * \param [in] beforeSplicedElement is an iterator of the element preceding the spliced entry
+		 */
+
+		void splice(EntryList& entryList, FreeEntryList::iterator beforeSplicedElement);
+
+	private:
+
+		/// number of 32-bit words in the bitmap
+		constexpr static size_t bitmapWords {(UINT8_MAX + 1) / 32};
+
+		/**
+		 * \brief Finds the lowest occupied priority which is greater than or equal to \a priority.
+		 *
+		 * \param [in] priority is the priority from which the search is started
+		 *
+		 * \return lowest occupied priority which is greater than or equal to \a priority, -1 if there is no such
+		 * priority
+		 */
+
+		int findOccupied(uint8_t priority) const;
+
+		/// pointers to last entries of groups of entries with the same priority, nullptr if the group is empty
+		std::array<Entry*, UINT8_MAX + 1> tails_;
+
+		/// occupancy bitmap, priority p is represented by bit (31 - p % 32) of word p / 32
+		std::array<uint32_t, bitmapWords> bitmap_;
+
+		/// summary of occupancy bitmap, non-empty word w is represented by bit (31 - w)
+		uint32_t summary_;
+	};
+
+	/// unique_ptr (with deleter) to PriorityBuckets
+	using PriorityBucketsUniquePointer = std::unique_ptr<PriorityBuckets, void(&)(PriorityBuckets*)>;
+
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
 	 * operations.
@@ -133,10 +210,13 @@ public:
 	 * elements (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
 	 * \param [in] elementSize is the size of single queue element, bytes
 	 * \param [in] maxElements is the number of elements in \a entryStorage array and valueStorage memory block
+	 * \param [in] priorityBucketsUniquePointer is a rvalue reference to PriorityBucketsUniquePointer with
+	 * PriorityBuckets object and appropriate deleter, nullptr to link new entries with linear search of entry list
 	 */
 
 	MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
-			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements);
+			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements,
+			PriorityBucketsUniquePointer&& priorityBucketsUniquePointer);
 
 	/**
 	 * \brief MessageQueueBase's destructor
@@ -153,6 +233,17 @@ public:
 		return popSemaphore_.getMaxValue();
 	}
 
+	/**
+	 * \return reference to semaphore with number of elements available for popping
+	 *
+	 * \warning The semaphore may only be used with waitForAny(), it must not be waited for or posted directly!
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -168,6 +259,25 @@ public:
 
 	int pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const QueueFunctor& functor);
 
+	/**
+	 * \brief Implementation of popBatch() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] priorities is a pointer to array for priorities of popped values, nullptr if priorities are not
+	 * needed
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will be
+	 * called once for each popped element and will get a pointer to storage with element
+	 * \param [in] maxCount is the maximum number of popped elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t* priorities,
+			const QueueFunctor& functor, size_t maxCount);
+
 	/**
 	 * \brief Implementation of push() using type-erased functor
 	 *
@@ -183,26 +293,49 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority, const QueueFunctor& functor);
 
+	/**
+	 * \brief Implementation of pushBatch() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] priority is the priority of new elements
+	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will be
+	 * called once for each pushed element and will get a pointer to storage for element
+	 * \param [in] maxCount is the maximum number of pushed elements
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements (valid even when
+	 * error code is returned); error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> push(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority,
+			const QueueFunctor& functor, size_t maxCount);
+
 private:
 
 	/**
 	 * \brief Implementation of pop() and push() using type-erased internal functor
 	 *
+	 * Waits for the first element (or slot) with \a waitSemaphoreFunctor, then transfers as many elements as possible
+	 * without waiting (but no more than \a maxCount). Whole batch is handled in one critical section.
+	 *
 	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
 	 * \param [in] internalFunctor is a reference to InternalFunctor which will execute actions related to
-	 * popping/pushing
+	 * popping/pushing - it will be called once for each element
+	 * \param [in] maxCount is the maximum number of popped/pushed elements
 	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for pop(), \a
 	 * pushSemaphore_ for push()
 	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
 	 * for pop(), \a popSemaphore_ for push()
 	 *
-	 * \return 0 if operation was successful, error code otherwise:
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped/pushed elements (valid
+	 * even when error code is returned); error codes:
 	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
 	 * - error codes returned by Semaphore::post();
 	 */
 
-	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const InternalFunctor& internalFunctor,
-			Semaphore& waitSemaphore, Semaphore& postSemaphore);
+	std::pair<int, size_t> popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const InternalFunctor& internalFunctor,
+			size_t maxCount, Semaphore& waitSemaphore, Semaphore& postSemaphore);
 
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
@@ -216,6 +349,9 @@ private:
 	/// storage for queue elements
 	const ValueStorageUniquePointer valueStorageUniquePointer_;
 
+	/// index of \a entryList_, nullptr if not used
+	const PriorityBucketsUniquePointer priorityBucketsUniquePointer_;
+
 	/// list of available entries, sorted in descending order of priority
 	EntryList entryList_;
 
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -20,6 +20,8 @@
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 #include <climits>
 
 namespace distortos
@@ -127,6 +129,19 @@ protected:
 
 	void doLock();
 
+	/**
+	 * \brief Moves thread blocked on some other list to blockedList_ of this mutex, without unblocking it.
+	 *
+	 * The thread will be unblocked when the ownership of the mutex is transferred to it. This is used to implement
+	 * "wait morphing" in ConditionVariable::notifyAll().
+	 *
+	 * \attention mutex must be locked and its protocol must be Protocol::none
+	 *
+	 * \param [in] iterator is the iterator to the blocked thread that will be moved
+	 */
+
+	void doRequeue(ThreadList::iterator iterator);
+
 	/**
 	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
 	 *
@@ -173,18 +188,47 @@ protected:
 		return static_cast<Type>((typeProtocol_ >> typeShift) & ((1 << typeWidth) - 1));
 	}
 
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	/**
+	 * \brief Tries to lock the mutex without enabling interrupt masking.
+	 *
+	 * Current thread becomes the owner of the mutex only if the mutex is unlocked, its protocol is not
+	 * Protocol::priorityProtect and the operation is not interrupted. Mutex with Protocol::priorityInheritance is not
+	 * added to the list of mutexes owned by current thread - this is deferred until the first thread blocks on it.
+	 *
+	 * \return true if the mutex was locked, false if the regular way (with interrupt masking enabled) must be used
+	 */
+
+	bool tryFastLock();
+
+	/**
+	 * \brief Tries to unlock the mutex without enabling interrupt masking.
+	 *
+	 * The mutex is unlocked only if it is owned by current thread, its protocol is not Protocol::priorityProtect, it is
+	 * not locked recursively, it is not on the list of mutexes owned by current thread, no threads are blocked on it
+	 * and the operation is not interrupted.
+	 *
+	 * \return true if the mutex was unlocked, false if the regular way (with interrupt masking enabled) must be used
+	 */
+
+	bool tryFastUnlock();
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 private:
 
 	/**
 	 * \brief Performs any actions required before actually blocking on the mutex.
 	 *
 	 * In case of priorityInheritance protocol, priority of owner thread is boosted and this mutex is set as the
-	 * blocking mutex of the calling thread. In all other cases this function does nothing.
+	 * blocking mutex of the calling thread. If the mutex was locked with tryFastLock(), it is also added to the list of
+	 * mutexes owned by owner thread. In all other cases this function does nothing.
 	 *
 	 * \attention must be called in block() and blockUntil() before actually blocking of the calling thread.
 	 */
 
-	void beforeBlock() const;
+	void beforeBlock();
 
 	/**
 	 * \brief Performs transfer of lock from current owner to next thread on the list.
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief WaitForAnyNode class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITFORANYNODE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITFORANYNODE_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+class Semaphore;
+
+namespace internal
+{
+
+/**
+ * \brief WaitForAnyNode class links thread waiting in waitForAny() with one of semaphores for which it waits
+ *
+ * All nodes of one thread point to the same list with this thread, so posting of any semaphore unblocks this thread
+ * only once.
+ */
+
+class WaitForAnyNode
+{
+public:
+
+	/**
+	 * \brief WaitForAnyNode's constructor
+	 */
+
+	constexpr WaitForAnyNode() :
+			node{},
+			threadList{}
+	{
+
+	}
+
+	/// node for intrusive list
+	estd::IntrusiveListNode node;
+
+	/// pointer to list with waiting thread, the list is empty when this thread was already unblocked
+	ThreadList* threadList;
+};
+
+/// intrusive list of WaitForAnyNode objects
+using WaitForAnyList = estd::IntrusiveList<WaitForAnyNode, &WaitForAnyNode::node>;
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value.
+ *
+ * Internal implementation of waitForAny() and its variants with timeout.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] semaphores is a pointer to array with pointers to semaphores
+ * \param [in] nodes is a pointer to array with nodes, one for each semaphore
+ * \param [in] count is the number of elements in \a semaphores and \a nodes arrays
+ * \param [in] timePoint is a pointer to time point at which the wait will be terminated, nullptr to wait without
+ * timeout
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore which has non-zero
+ * value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a count is 0;
+ * - ETIMEDOUT - none of semaphores had non-zero value before the specified timeout expired;
+ */
+
+std::pair<int, size_t> waitForAny(Semaphore* const* semaphores, WaitForAnyNode* nodes, size_t count,
+		const TickClock::time_point* timePoint);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_WAITFORANYNODE_HPP_
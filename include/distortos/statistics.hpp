@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,31 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include <cstdint>
 
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#include <array>
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1 || \
+		DISTORTOS_TLSF_HEAP_ENABLE == 1 || DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include <cstddef>
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1 ||
+		// DISTORTOS_TLSF_HEAP_ENABLE == 1 || DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/ThreadIdentifier.hpp"
+#include "distortos/ThreadState.hpp"
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
 namespace distortos
 {
 
@@ -23,12 +46,205 @@ namespace statistics
 /// \addtogroup statistics
 /// \{
 
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+/// InterruptMaskingStatistics struct holds statistics of periods during which interrupt masking was enabled
+struct InterruptMaskingStatistics
+{
+	/// number of buckets in histogram
+	constexpr static size_t histogramBuckets {16};
+
+	/// histogram of durations of periods - bucket 0 counts periods shorter than 32 core clock cycles, bucket n counts
+	/// periods in [2^(n + 4); 2^(n + 5)) range, last bucket also counts all longer periods
+	std::array<uint32_t, histogramBuckets> histogram;
+
+	/// address of code which enabled interrupt masking for the longest period, nullptr if no period was recorded
+	const void* worstCaseAddress;
+
+	/// duration of the longest period, core clock cycles
+	uint32_t worstCaseDuration;
+};
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+/// HeapStatistics struct holds statistics of the heap
+struct HeapStatistics
+{
+	/// size of the heap available for allocations when it is empty, bytes
+	size_t size;
+
+	/// sum of sizes of all allocated blocks (which may be slightly larger than the requested sizes), bytes
+	size_t usedSize;
+
+	/// the highest value of \a usedSize since initialization of the heap, bytes
+	size_t peakUsedSize;
+
+	/// sum of sizes of all free blocks, bytes
+	size_t freeSize;
+
+	/// size of the largest free block - the largest allocation which is guaranteed to succeed, bytes
+	size_t largestFreeSize;
+
+	/// number of allocated blocks
+	size_t usedBlocks;
+
+	/// number of free blocks
+	size_t freeBlocks;
+
+	/// fragmentation of free memory, 0.1 % units - 0 (all free memory in single block) to 1000, computed as
+	/// 1 - \a largestFreeSize / \a freeSize
+	uint16_t fragmentation;
+};
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+/// ThreadStatistics struct holds statistics of a thread
+struct ThreadStatistics
+{
+	/// identifier of the thread
+	ThreadIdentifier identifier;
+
+	/// size of thread's stack, bytes
+	size_t stackSize;
+
+	/// thread's stack "high water mark" (max usage), bytes
+	size_t stackHighWaterMark;
+
+	/// number of context switches to the thread
+	uint64_t contextSwitchCount;
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/// CPU time of the thread, core clock cycles
+	uint64_t cpuTime;
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	/// priority of the thread
+	uint8_t priority;
+
+	/// effective priority of the thread
+	uint8_t effectivePriority;
+
+	/// state of the thread
+	ThreadState state;
+};
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
 /**
  * \return number of context switches
  */
 
 uint64_t getContextSwitchCount();
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+/**
+ * \return average CPU load since start of CPU time accounting, 0.1 % units - 0 (idle) to 1000 (fully loaded)
+ */
+
+uint16_t getCpuLoad();
+
+/**
+ * \return CPU time of idle thread, core clock cycles
+ */
+
+uint64_t getIdleTime();
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+/**
+ * \brief Gets CPU load in a sliding window of recent measurement periods.
+ *
+ * The load is measured by classifying each tick as idle or busy, so its resolution is one tick, but it also accounts
+ * for time during which the core was sleeping. Each measurement period is DISTORTOS_SCHEDULER_CPU_LOAD_PERIOD ticks
+ * long and DISTORTOS_SCHEDULER_CPU_LOAD_PERIODS most recent completed periods are recorded.
+ *
+ * \param [in] periods is the number of most recent completed measurement periods over which CPU load is computed,
+ * values greater than the number of recorded periods are limited to this number
+ *
+ * \return CPU load over \a periods most recent completed measurement periods, 0.1 % units - 0 (idle) to 1000 (fully
+ * loaded), 0 if no period was completed yet or \a periods is 0
+ */
+
+uint16_t getCpuLoad(size_t periods);
+
+/**
+ * \return total number of ticks during which idle thread was running
+ */
+
+uint64_t getIdleTickCount();
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+/**
+ * \return total number of missed deadlines of all threads using SchedulingPolicy::deadline
+ */
+
+uint64_t getDeadlineMissCount();
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+/**
+ * \return statistics of the heap
+ */
+
+HeapStatistics getHeapStatistics();
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+/**
+ * \brief Gets statistics of all threads of the current thread group.
+ *
+ * All threads of the current thread group which were started and were not destroyed yet (including terminated threads)
+ * are reported - with the default thread group of main() thread this also includes idle thread and main() thread.
+ * Statistics of all threads - except stack "high water marks" - are collected at the same time, with interrupt masking
+ * enabled, so they are consistent. Stack "high water mark" of each thread is then computed separately, with interrupt
+ * masking disabled, as it requires scanning of the whole stack. If the thread was destroyed in the meantime, its stack
+ * "high water mark" is 0.
+ *
+ * \param [out] buffer is a pointer to array of ThreadStatistics objects which will be filled, may be nullptr if
+ * \a size is 0
+ * \param [in] size is the number of elements in \a buffer
+ *
+ * \return number of threads, may be greater than \a size - in that case only first \a size threads are reported
+ */
+
+size_t getThreadStatistics(ThreadStatistics* buffer, size_t size);
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+/**
+ * \return statistics of periods during which interrupt masking was enabled
+ */
+
+InterruptMaskingStatistics getInterruptMaskingStatistics();
+
+/**
+ * \brief Resets statistics of periods during which interrupt masking was enabled.
+ *
+ * This may be used to discard periods recorded during initialization of application.
+ */
+
+void resetInterruptMaskingStatistics();
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
 /// \}
 
 }	// namespace statistics
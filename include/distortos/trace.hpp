@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \brief trace namespace header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACE_HPP_
+#define INCLUDE_DISTORTOS_TRACE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace trace
+{
+
+/// \addtogroup statistics
+/// \{
+
+#if DISTORTOS_TRACE_ENABLE == 1
+
+/**
+ * \brief Records user marker in trace buffer.
+ *
+ * \param [in] value is the value of marker, it is shown in decoded trace
+ */
+
+void mark(uint32_t value);
+
+/**
+ * \brief Removes all records from trace buffer.
+ */
+
+void reset();
+
+#else	// DISTORTOS_TRACE_ENABLE != 1
+
+/**
+ * \brief Records user marker in trace buffer - empty implementation used when trace is disabled.
+ */
+
+inline void mark(uint32_t)
+{
+
+}
+
+/**
+ * \brief Removes all records from trace buffer - empty implementation used when trace is disabled.
+ */
+
+inline void reset()
+{
+
+}
+
+#endif	// DISTORTOS_TRACE_ENABLE != 1
+
+/// \}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TRACE_HPP_
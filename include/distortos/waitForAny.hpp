@@ -0,0 +1,176 @@
+/**
+ * \file
+ * \brief waitForAny() header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WAITFORANY_HPP_
+#define INCLUDE_DISTORTOS_WAITFORANY_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#include "distortos/Semaphore.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value.
+ *
+ * Similar to poll() - https://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html
+ *
+ * The value of semaphores is not changed - after this function returns, the caller should try to lock the semaphore
+ * (Semaphore::tryWait()) or pop from the queue (for example FifoQueue::tryPop()) which became ready. As several threads
+ * may wait for the same object, this attempt may fail, in which case the wait should be repeated.
+ *
+ * Queues can be used with this function via their getPopSemaphore() member function, software timers - via a
+ * semaphore posted from their function.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam N is the number of semaphores
+ *
+ * \param [in] semaphores is a reference to array with pointers to semaphores
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore (in \a semaphores
+ * array) which has non-zero value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t N>
+std::pair<int, size_t> waitForAny(Semaphore* const (&semaphores)[N])
+{
+	static_assert(N != 0, "At least one semaphore is required!");
+
+	std::array<internal::WaitForAnyNode, N> nodes;
+	return internal::waitForAny(semaphores, nodes.data(), N, nullptr);
+}
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value until given time point.
+ *
+ * Similar to waitForAny(), but the wait is terminated when the specified timeout expires.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam N is the number of semaphores
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] semaphores is a reference to array with pointers to semaphores
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore (in \a semaphores
+ * array) which has non-zero value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - none of semaphores had non-zero value before the specified timeout expired;
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t N>
+std::pair<int, size_t> tryWaitForAnyUntil(const TickClock::time_point timePoint, Semaphore* const (&semaphores)[N])
+{
+	static_assert(N != 0, "At least one semaphore is required!");
+
+	std::array<internal::WaitForAnyNode, N> nodes;
+	return internal::waitForAny(semaphores, nodes.data(), N, &timePoint);
+}
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value until given time point.
+ *
+ * Template variant of tryWaitForAnyUntil(TickClock::time_point, Semaphore* const (&)[N]).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ * \tparam N is the number of semaphores
+ *
+ * \param [in] timePoint is the time point at which the wait will be terminated
+ * \param [in] semaphores is a reference to array with pointers to semaphores
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore (in \a semaphores
+ * array) which has non-zero value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - none of semaphores had non-zero value before the specified timeout expired;
+ *
+ * \ingroup synchronization
+ */
+
+template<typename Duration, size_t N>
+std::pair<int, size_t> tryWaitForAnyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+		Semaphore* const (&semaphores)[N])
+{
+	return tryWaitForAnyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), semaphores);
+}
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value for given duration of time.
+ *
+ * Similar to waitForAny(), but the wait is terminated when the specified timeout expires.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam N is the number of semaphores
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] semaphores is a reference to array with pointers to semaphores
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore (in \a semaphores
+ * array) which has non-zero value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - none of semaphores had non-zero value before the specified timeout expired;
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t N>
+std::pair<int, size_t> tryWaitForAnyFor(const TickClock::duration duration, Semaphore* const (&semaphores)[N])
+{
+	return tryWaitForAnyUntil(TickClock::now() + duration + TickClock::duration{1}, semaphores);
+}
+
+/**
+ * \brief Waits for any of semaphores to have non-zero value for given duration of time.
+ *
+ * Template variant of tryWaitForAnyFor(TickClock::duration, Semaphore* const (&)[N]).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ * \tparam N is the number of semaphores
+ *
+ * \param [in] duration is the duration after which the wait will be terminated
+ * \param [in] semaphores is a reference to array with pointers to semaphores
+ *
+ * \return pair with return code (0 on success, error code otherwise) and index of first semaphore (in \a semaphores
+ * array) which has non-zero value; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - ETIMEDOUT - none of semaphores had non-zero value before the specified timeout expired;
+ *
+ * \ingroup synchronization
+ */
+
+template<typename Rep, typename Period, size_t N>
+std::pair<int, size_t> tryWaitForAnyFor(const std::chrono::duration<Rep, Period> duration,
+		Semaphore* const (&semaphores)[N])
+{
+	return tryWaitForAnyFor(std::chrono::duration_cast<TickClock::duration>(duration), semaphores);
+}
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#endif	// INCLUDE_DISTORTOS_WAITFORANY_HPP_
@@ -0,0 +1,256 @@
+/**
+ * \file
+ * \brief InplaceFunction template class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ESTD_INPLACEFUNCTION_HPP_
+#define ESTD_INPLACEFUNCTION_HPP_
+
+#include "estd/invoke.hpp"
+
+#include <new>
+#include <type_traits>
+
+#include <cassert>
+#include <cstddef>
+
+namespace estd
+{
+
+template<typename Signature, size_t Capacity>
+class InplaceFunction;
+
+/**
+ * \brief InplaceFunction class is a type-erased wrapper for callable objects, similar to std::function, but with
+ * storage for the callable object embedded in the wrapper.
+ *
+ * Unlike std::function, InplaceFunction never allocates memory - callable objects which do not fit in the storage are
+ * rejected at compile time. InplaceFunction is move-only, so callable objects don't have to be copyable.
+ *
+ * \tparam R is the type returned by <em>InplaceFunction::operator()() const</em>
+ * \tparam Args are the types of arguments for <em>InplaceFunction::operator()() const</em>
+ * \tparam Capacity is the size of storage for callable object, bytes
+ */
+
+template<typename R, typename... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity>
+{
+public:
+
+	/**
+	 * \brief InplaceFunction's constructor
+	 *
+	 * Constructs empty object.
+	 */
+
+	constexpr InplaceFunction() noexcept :
+			storage_{},
+			invoker_{},
+			manager_{}
+	{
+
+	}
+
+	/**
+	 * \brief InplaceFunction's constructor
+	 *
+	 * Constructs empty object.
+	 */
+
+	constexpr InplaceFunction(std::nullptr_t) noexcept :
+			InplaceFunction{}
+	{
+
+	}
+
+	/**
+	 * \brief InplaceFunction's constructor
+	 *
+	 * \tparam Function is the type of callable object, its decayed type must fit in the storage of InplaceFunction
+	 *
+	 * \param [in] function is the callable object which will be moved or copied to the storage of InplaceFunction
+	 */
+
+	template<typename Function, typename = typename std::enable_if<
+			std::is_same<typename std::decay<Function>::type, InplaceFunction>::value == false>::type>
+	InplaceFunction(Function&& function) :
+			storage_{},
+			invoker_{invoke<typename std::decay<Function>::type>},
+			manager_{manage<typename std::decay<Function>::type>}
+	{
+		using Functor = typename std::decay<Function>::type;
+		static_assert(sizeof(Functor) <= sizeof(storage_),
+				"Callable object is too large for the storage of estd::InplaceFunction!");
+		static_assert(alignof(Functor) <= alignof(Storage),
+				"Alignment of callable object is too high for the storage of estd::InplaceFunction!");
+
+		new (&storage_) Functor(std::forward<Function>(function));
+	}
+
+	/**
+	 * \brief InplaceFunction's move constructor
+	 *
+	 * \param [in] other is a rvalue reference to InplaceFunction used as source of move, it is left empty
+	 */
+
+	InplaceFunction(InplaceFunction&& other) noexcept :
+			storage_{},
+			invoker_{other.invoker_},
+			manager_{other.manager_}
+	{
+		if (manager_ != nullptr)
+			manager_(&storage_, other.storage_);
+		other.invoker_ = {};
+		other.manager_ = {};
+	}
+
+	/**
+	 * \brief InplaceFunction's destructor
+	 *
+	 * Destroys contained callable object (if any).
+	 */
+
+	~InplaceFunction()
+	{
+		if (manager_ != nullptr)
+			manager_(nullptr, storage_);
+	}
+
+	/**
+	 * \brief InplaceFunction's move assignment operator
+	 *
+	 * Destroys contained callable object (if any) before callable object from \a other is moved.
+	 *
+	 * \param [in] other is a rvalue reference to InplaceFunction used as source of move, it is left empty
+	 *
+	 * \return reference to this
+	 */
+
+	InplaceFunction& operator=(InplaceFunction&& other) noexcept
+	{
+		if (&other == this)
+			return *this;
+
+		if (manager_ != nullptr)
+			manager_(nullptr, storage_);
+		invoker_ = other.invoker_;
+		manager_ = other.manager_;
+		if (manager_ != nullptr)
+			manager_(&storage_, other.storage_);
+		other.invoker_ = {};
+		other.manager_ = {};
+		return *this;
+	}
+
+	/**
+	 * \brief InplaceFunction's assignment operator
+	 *
+	 * Destroys contained callable object (if any), leaving this object empty.
+	 *
+	 * \return reference to this
+	 */
+
+	InplaceFunction& operator=(std::nullptr_t) noexcept
+	{
+		if (manager_ != nullptr)
+			manager_(nullptr, storage_);
+		invoker_ = {};
+		manager_ = {};
+		return *this;
+	}
+
+	/**
+	 * \return true if this object contains callable object, false if it is empty
+	 */
+
+	explicit operator bool() const noexcept
+	{
+		return invoker_ != nullptr;
+	}
+
+	/**
+	 * \brief InplaceFunction's function call operator
+	 *
+	 * \pre This object is not empty.
+	 *
+	 * \param [in,out] args are arguments for contained callable object
+	 *
+	 * \return value returned by contained callable object
+	 */
+
+	R operator()(Args... args) const
+	{
+		assert(invoker_ != nullptr && "Empty estd::InplaceFunction cannot be called!");
+		return invoker_(storage_, std::forward<Args>(args)...);
+	}
+
+	InplaceFunction(const InplaceFunction&) = delete;
+	const InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+private:
+
+	/// type of storage for callable object
+	using Storage = typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type;
+
+	/// type of function which calls callable object in storage with given arguments
+	using Invoker = R(Storage&, Args&&...);
+
+	/// type of function which move-constructs callable object in other storage (if not nullptr) and destroys callable
+	/// object in storage
+	using Manager = void(Storage*, Storage&);
+
+	/**
+	 * \brief Calls callable object in storage.
+	 *
+	 * \tparam Functor is the type of callable object in storage
+	 *
+	 * \param [in] storage is a reference to storage with callable object
+	 * \param [in,out] args are arguments for callable object
+	 *
+	 * \return value returned by callable object
+	 */
+
+	template<typename Functor>
+	static R invoke(Storage& storage, Args&&... args)
+	{
+		return static_cast<R>(estd::invoke(*reinterpret_cast<Functor*>(&storage), std::forward<Args>(args)...));
+	}
+
+	/**
+	 * \brief Moves callable object in storage to other storage and destroys it.
+	 *
+	 * \tparam Functor is the type of callable object in storage
+	 *
+	 * \param [out] destination is a pointer to storage to which callable object will be moved, nullptr to just destroy
+	 * callable object
+	 * \param [in] source is a reference to storage with callable object
+	 */
+
+	template<typename Functor>
+	static void manage(Storage* const destination, Storage& source)
+	{
+		const auto functor = reinterpret_cast<Functor*>(&source);
+		if (destination != nullptr)
+			new (destination) Functor(std::move(*functor));
+		functor->~Functor();
+	}
+
+	/// storage for callable object
+	mutable Storage storage_;
+
+	/// pointer to function which calls callable object, nullptr if this object is empty
+	Invoker* invoker_;
+
+	/// pointer to function which moves and destroys callable object, nullptr if this object is empty
+	Manager* manager_;
+};
+
+}	// namespace estd
+
+#endif	// ESTD_INPLACEFUNCTION_HPP_
@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+
+#
+# file: traceToChromeJson.py
+#
+# author: Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+#
+
+#
+# Converts binary dump of distortos trace buffer to Chrome/Perfetto JSON trace format.
+#
+# The dump can be obtained with GDB:
+#     dump binary value trace.bin distortos::internal::traceBufferInstance
+# Converted trace can be opened with https://ui.perfetto.dev or chrome://tracing
+#
+
+import argparse
+import json
+import struct
+import sys
+
+headerFormat = '<IHHIII'
+recordFormat = '<IIBBH'
+magic = 0x43525444
+version = 1
+
+eventTypes = ('contextSwitch', 'block', 'unblock', 'mutexLock', 'mutexTransfer', 'mutexUnlock', 'queuePop',
+		'queuePush', 'softwareTimerExpiry', 'userMarker')
+
+threadStates = ('created', 'runnable', 'terminated', 'sleeping', 'blockedOnSemaphore', 'suspended', 'blockedOnMutex',
+		'blockedOnConditionVariable', 'waitingForSignal', 'detached', 'blockedOnRwLock', 'blockedOnEventFlags')
+
+threadStatesWithoutSignals = threadStates[:8] + threadStates[9:]
+
+unblockReasons = ('unblockRequest', 'timeout', 'signal')
+
+class DecodeError(RuntimeError):
+	"""Decode error exception."""
+
+	pass
+
+def decode(data):
+	"""Decodes binary dump of trace buffer.
+
+	Returns list of records from the oldest to the newest, each record is a tuple with timestamp, type, object and
+	argument.
+
+	* `data` is the binary dump of trace buffer
+	"""
+
+	headerSize = struct.calcsize(headerFormat)
+	if len(data) < headerSize:
+		raise DecodeError('Dump is too short for trace buffer header')
+	dumpMagic, dumpVersion, recordSize, capacity, count, index = struct.unpack_from(headerFormat, data)
+	if dumpMagic != magic:
+		raise DecodeError('Invalid magic value 0x{:08x}, expected 0x{:08x}'.format(dumpMagic, magic))
+	if dumpVersion != version:
+		raise DecodeError('Unsupported version {}, expected {}'.format(dumpVersion, version))
+	if recordSize != struct.calcsize(recordFormat):
+		raise DecodeError('Unsupported record size {}'.format(recordSize))
+	if len(data) < headerSize + capacity * recordSize or count > capacity or index >= capacity:
+		raise DecodeError('Dump is truncated or corrupted')
+
+	records = []
+	for i in range(count):
+		position = (index + capacity - count + i) % capacity
+		offset = headerSize + position * recordSize
+		timestamp, object, type, argument, _ = struct.unpack_from(recordFormat, data, offset)
+		records.append((timestamp, type, object, argument))
+	return records
+
+def convert(records, frequency, threadNames, states):
+	"""Converts decoded records to list of events in Chrome JSON trace format.
+
+	Context switches are converted to "running" slices on tracks of threads, all other records are converted to instant
+	events. Block and unblock events are placed on the track of affected thread, remaining ones - on the track of the
+	thread which was running when the event was recorded.
+
+	* `records` is a list of decoded records
+	* `frequency` is the frequency of core cycle counter, Hz
+	* `threadNames` is a dictionary with names of threads, indexed by addresses of thread control blocks
+	* `states` is a tuple with names of thread states
+	"""
+
+	events = []
+	threads = set()
+	current = None
+	cycles = 0
+	previous = None
+	for timestamp, type, object, argument in records:
+		# timestamps are 32-bit, so they are unwrapped assuming that consecutive records are less than 2^32 cycles apart
+		if previous is not None:
+			cycles += (timestamp - previous) & 0xffffffff
+		previous = timestamp
+		time = cycles * 1000000.0 / frequency
+		name = eventTypes[type] if type < len(eventTypes) else 'unknown{}'.format(type)
+
+		if name == 'contextSwitch':
+			if current is not None:
+				events.append({'name': 'running', 'ph': 'E', 'pid': 1, 'tid': current, 'ts': time})
+			current = object
+			threads.add(current)
+			events.append({'name': 'running', 'ph': 'B', 'pid': 1, 'tid': current, 'ts': time})
+			continue
+
+		arguments = {'object': '0x{:08x}'.format(object)}
+		track = current if current is not None else 0
+		if name == 'block':
+			track = object
+			arguments = {'state': states[argument] if argument < len(states) else argument}
+		elif name == 'unblock':
+			track = object
+			arguments = {'reason': unblockReasons[argument] if argument < len(unblockReasons) else argument}
+		elif name == 'userMarker':
+			arguments = {'value': object}
+		threads.add(track)
+		events.append({'name': name, 'ph': 'i', 's': 't', 'pid': 1, 'tid': track, 'ts': time, 'args': arguments})
+
+	if current is not None:
+		events.append({'name': 'running', 'ph': 'E', 'pid': 1, 'tid': current, 'ts': cycles * 1000000.0 / frequency})
+
+	events.append({'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'distortos'}})
+	for thread in sorted(threads):
+		name = threadNames.get(thread, 'unknown' if thread == 0 else '0x{:08x}'.format(thread))
+		events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': thread, 'args': {'name': name}})
+	return events
+
+########################################################################################################################
+# main
+########################################################################################################################
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser(description = 'Converts binary dump of distortos trace buffer to Chrome/Perfetto '
+			'JSON trace format.')
+	parser.add_argument('input', type = argparse.FileType('rb'), help = 'binary dump of trace buffer')
+	parser.add_argument('output', type = argparse.FileType('w'), help = 'output JSON file')
+	parser.add_argument('--frequency', type = float, required = True, help = 'frequency of core clock, Hz')
+	parser.add_argument('--thread-name', action = 'append', default = [], metavar = 'ADDRESS=NAME',
+			help = 'name of thread with thread control block at ADDRESS, may be used multiple times')
+	parser.add_argument('--no-signals', action = 'store_true',
+			help = 'trace was recorded with signals disabled (distortos_Scheduler_02_Support_for_signals is OFF)')
+	arguments = parser.parse_args()
+
+	threadNames = {}
+	for threadName in arguments.thread_name:
+		address, _, name = threadName.partition('=')
+		threadNames[int(address, 0)] = name
+
+	try:
+		records = decode(arguments.input.read())
+	except DecodeError as exception:
+		sys.exit('Decoding trace buffer failed: {}'.format(exception))
+
+	states = threadStatesWithoutSignals if arguments.no_signals == True else threadStates
+	events = convert(records, arguments.frequency, threadNames, states)
+	json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, arguments.output, indent = '\t')
@@ -2,7 +2,7 @@
  * \file
  * \brief PendSV_Handler() for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,12 @@
 
 #include "distortos/chip/CMSIS-proxy.h"
 
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+#include "ARMv6-M-ARMv7-M-setStackGuardMpuRegion.hpp"
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
 #ifdef DISTORTOS_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
 
 #include "distortos/FATAL_ERROR.h"
@@ -51,6 +57,8 @@ void checkStackPointerWrapper(const void* const stackPointer)
 /**
  * \brief Wrapper for void* distortos::internal::getScheduler().switchContext(void*)
  *
+ * If stack guard with MPU is enabled, MPU region protecting "stack guard" of new thread is also configured.
+ *
  * \param [in] stackPointer is the current value of current thread's stack pointer
  *
  * \return new thread's stack pointer
@@ -58,7 +66,18 @@ void checkStackPointerWrapper(const void* const stackPointer)
 
 void* schedulerSwitchContextWrapper(void* const stackPointer)
 {
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+	auto& scheduler = internal::getScheduler();
+	const auto newStackPointer = scheduler.switchContext(stackPointer);
+	architecture::setStackGuardMpuRegion(scheduler.getCurrentThreadControlBlock().getStack().getStackGuard());
+	return newStackPointer;
+
+#else	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
+
 	return internal::getScheduler().switchContext(stackPointer);
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
 }
 
 }	// namespace
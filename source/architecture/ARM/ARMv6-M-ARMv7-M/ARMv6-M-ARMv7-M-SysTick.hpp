@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief Configuration of SysTick timer for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
+
+#include "distortos/chip/clocks.hpp"
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// period of SysTick timer clocked from core clock, counts
+constexpr uint32_t sysTickCorePeriod {chip::ahbFrequency / DISTORTOS_TICK_FREQUENCY};
+
+/// max period of SysTick timer, counts
+constexpr uint32_t sysTickMaxPeriod {1 << 24};
+
+/// true if SysTick timer must be clocked from core clock divided by 8, false otherwise
+constexpr bool sysTickDivideBy8 {sysTickCorePeriod > sysTickMaxPeriod};
+
+/// period of SysTick timer, counts
+constexpr uint32_t sysTickPeriod {sysTickDivideBy8 == false ? sysTickCorePeriod : sysTickCorePeriod / 8};
+
+// at least one of the periods must be valid
+static_assert(sysTickPeriod <= sysTickMaxPeriod, "Invalid SysTick configuration!");
+
+/// value of SysTick->CTRL register with enabled timer
+constexpr uint32_t sysTickCtrl {(sysTickDivideBy8 == true ? 0 : SysTick_CTRL_CLKSOURCE_Msk) | SysTick_CTRL_ENABLE_Msk |
+		SysTick_CTRL_TICKINT_Msk};
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SYSTICK_HPP_
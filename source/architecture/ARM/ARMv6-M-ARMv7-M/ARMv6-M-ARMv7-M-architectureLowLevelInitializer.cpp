@@ -2,7 +2,7 @@
  * \file
  * \brief Low-level architecture initializer for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,8 @@
 
 #include "distortos/chip/CMSIS-proxy.h"
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
 
 namespace distortos
@@ -40,6 +42,14 @@ void architectureLowLevelInitializer()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= 3 << 10 * 2 | 3 << 11 * 2;	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1 || DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || \
+		DISTORTOS_TRACE_ENABLE == 1
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->LAR = 0xc5acce55;	// unlock write access to DWT registers, required on ARM Cortex-M7
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1 || DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 ||
+		// DISTORTOS_TRACE_ENABLE == 1
 }
 
 BIND_LOW_LEVEL_INITIALIZER(30, architectureLowLevelInitializer);
@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief getCycleCount() implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1 || DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || \
+		DISTORTOS_TRACE_ENABLE == 1
+
+#ifdef __ARM_ARCH_6M__
+#error "ARMv6-M doesn't have DWT cycle counter required for CPU time accounting, interrupt masking statistics and trace"
+#endif	// def __ARM_ARCH_6M__
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycleCount()
+{
+	return DWT->CYCCNT;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1 || DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 ||
+		// DISTORTOS_TRACE_ENABLE == 1
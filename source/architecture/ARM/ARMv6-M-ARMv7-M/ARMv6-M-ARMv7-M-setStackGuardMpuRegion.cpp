@@ -0,0 +1,88 @@
+/**
+ * \file
+ * \brief setStackGuardMpuRegion() implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+#ifdef __ARM_ARCH_6M__
+#error "ARMv6-M doesn't support stack guard with MPU"
+#endif	// def __ARM_ARCH_6M__
+
+#if defined(DISTORTOS_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE) || \
+		defined(DISTORTOS_CHECK_STACK_GUARD_SYSTEM_TICK_ENABLE)
+#error "Stack guard with MPU cannot be used together with checks of stack guard contents"
+#endif	// defined(DISTORTOS_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE) ||
+		// defined(DISTORTOS_CHECK_STACK_GUARD_SYSTEM_TICK_ENABLE)
+
+#include "ARMv6-M-ARMv7-M-setStackGuardMpuRegion.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/internal/scheduler/stackGuardSize.hpp"
+
+#if __MPU_PRESENT != 1
+#error "Stack guard with MPU requires a chip with MPU"
+#endif	// __MPU_PRESENT != 1
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// log2 of minimal size of MPU region
+constexpr uint32_t minimalMpuRegionSizeLog2 {5};
+
+static_assert(internal::stackGuardSize + DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT >= 2 << minimalMpuRegionSizeLog2,
+		"\"Stack guard\" is too small to contain minimal MPU region!");
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void setStackGuardMpuRegion(const void* const stackGuard)
+{
+	const auto begin = reinterpret_cast<uintptr_t>(stackGuard);
+	const auto end = begin + internal::stackGuardSize;
+
+	// start with the largest power of two not greater than size of "stack guard" and shrink it until the naturally
+	// aligned block fits in "stack guard"; static_assert() above guarantees that 32-byte block always fits
+	uint32_t sizeLog2 = 31 - __CLZ(internal::stackGuardSize);
+	auto regionBegin = (begin + (1u << sizeLog2) - 1) >> sizeLog2 << sizeLog2;
+	while (regionBegin + (1u << sizeLog2) > end && sizeLog2 > minimalMpuRegionSizeLog2)
+	{
+		--sizeLog2;
+		regionBegin = (begin + (1u << sizeLog2) - 1) >> sizeLog2 << sizeLog2;
+	}
+
+	// highest region implemented by the core (7 or 15) has the highest priority, so it overrides all other regions
+	// configured by the application
+	const auto stackGuardMpuRegion = ((MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos) - 1;
+	ARM_MPU_SetRegion(ARM_MPU_RBAR(stackGuardMpuRegion, regionBegin),
+			ARM_MPU_RASR(1, ARM_MPU_AP_NONE, 0, 0, 0, 0, 0, sizeLog2 - 1));
+	__DSB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
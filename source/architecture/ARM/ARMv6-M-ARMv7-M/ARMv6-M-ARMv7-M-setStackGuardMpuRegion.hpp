@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief setStackGuardMpuRegion() declaration
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SETSTACKGUARDMPUREGION_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SETSTACKGUARDMPUREGION_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Configures MPU region which protects "stack guard" of a thread.
+ *
+ * The region is the largest naturally aligned power-of-two block (at least 32 bytes) which fits in "stack guard". Any
+ * access to this region - both privileged and unprivileged - causes MemManage fault.
+ *
+ * \param [in] stackGuard is a pointer to beginning of thread's "stack guard"
+ */
+
+void setStackGuardMpuRegion(const void* stackGuard);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV6_M_ARMV7_M_SETSTACKGUARDMPUREGION_HPP_
@@ -2,18 +2,30 @@
  * \file
  * \brief Start of scheduling for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
-#include "distortos/chip/clocks.hpp"
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
 
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+#include "ARMv6-M-ARMv7-M-setStackGuardMpuRegion.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/FATAL_ERROR.h"
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
 namespace distortos
 {
 
@@ -49,16 +61,22 @@ void startScheduling()
 	NVIC_SetPriority(SVCall_IRQn, svcallPriority);
 
 	// configure SysTick timer as the tick timer
-	constexpr uint32_t period {chip::ahbFrequency / DISTORTOS_TICK_FREQUENCY};
-	constexpr uint32_t periodDividedBy8 {period / 8};
-	constexpr uint32_t maxSysTickPeriod {1 << 24};
-	constexpr bool divideBy8 {period > maxSysTickPeriod};
-	// at least one of the periods must be valid
-	static_assert(period <= maxSysTickPeriod || periodDividedBy8 <= maxSysTickPeriod, "Invalid SysTick configuration!");
-	SysTick->LOAD = (divideBy8 == false ? period : periodDividedBy8) - 1;
+	SysTick->LOAD = sysTickPeriod - 1;
 	SysTick->VAL = 0;
-	SysTick->CTRL = (divideBy8 == true ? 0 : SysTick_CTRL_CLKSOURCE_Msk) | SysTick_CTRL_ENABLE_Msk |
-			SysTick_CTRL_TICKINT_Msk;
+	SysTick->CTRL = sysTickCtrl;
+
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+	// ARMv7-M MPU implements either 0, 8 or 16 regions
+	if (((MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos) < 8)
+		FATAL_ERROR("Stack guard with MPU requires MPU with at least 8 regions!");
+
+	// protect "stack guard" of main() thread, which is the current thread
+	setStackGuardMpuRegion(internal::getScheduler().getCurrentThreadControlBlock().getStack().getStackGuard());
+	// background region for privileged accesses, MemManage fault enabled
+	ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
 }
 
 BIND_LOW_LEVEL_INITIALIZER(70, startScheduling);
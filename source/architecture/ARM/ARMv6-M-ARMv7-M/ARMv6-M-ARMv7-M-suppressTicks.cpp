@@ -0,0 +1,122 @@
+/**
+ * \file
+ * \brief suppressTicks() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/suppressTicks.hpp"
+
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Restarts SysTick timer.
+ *
+ * The first period after restart has \a firstPeriod counts, all following periods are regular.
+ *
+ * \param [in] firstPeriod is the number of counts in the first period after restart, [2; sysTickMaxPeriod]
+ */
+
+void restartSysTick(const uint32_t firstPeriod)
+{
+	SysTick->LOAD = firstPeriod - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL = sysTickCtrl;
+	// the counter is reloaded with the value of SysTick->LOAD in the first cycle after enabling
+	SysTick->LOAD = sysTickPeriod - 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t suppressTicks(const uint32_t ticks)
+{
+	constexpr uint32_t maxTicks {sysTickMaxPeriod / sysTickPeriod};
+	const auto suppressedTicks = ticks < maxTicks ? ticks : maxTicks;
+
+	// interrupts masked with BASEPRI would not wake the core up, so they are temporarily masked with PRIMASK instead
+	const auto primask = __get_PRIMASK();
+	__disable_irq();
+#if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+	const auto basepri = __get_BASEPRI();
+	__set_BASEPRI(0);
+#endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+
+	// SysTick is stopped only for the few instructions needed to reprogram it - time spent in this window (and in the
+	// similar one after wake-up) is not accounted for, which is the source of the drift documented in the header
+	SysTick->CTRL = sysTickCtrl & ~SysTick_CTRL_ENABLE_Msk;
+	const auto remainingCounts = SysTick->VAL;
+	uint32_t elapsedTicks {};
+
+	// if "tick" interrupt is pending, the core would not sleep anyway
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0 || remainingCounts == 0)
+		SysTick->CTRL = sysTickCtrl;
+	else
+	{
+		// one-shot period measured from the last tick boundary is (suppressedTicks * sysTickPeriod)
+		const auto oneShotPeriod = remainingCounts + (suppressedTicks - 1) * sysTickPeriod;
+		SysTick->LOAD = oneShotPeriod - 1;
+		SysTick->VAL = 0;
+		SysTick->CTRL = sysTickCtrl;
+
+		__DSB();
+		__WFI();
+		__ISB();
+
+		SysTick->CTRL = sysTickCtrl & ~SysTick_CTRL_ENABLE_Msk;
+		const auto value = SysTick->VAL;
+
+		if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)	// one-shot timer expired, the last tick is pending
+		{
+			elapsedTicks = suppressedTicks - 1;
+			// counter was reloaded with (oneShotPeriod - 1) at expiry
+			const auto countsAfterExpiry = oneShotPeriod - 1 - value;
+			restartSysTick(countsAfterExpiry + 2 < sysTickPeriod ? sysTickPeriod - countsAfterExpiry :
+					sysTickPeriod);
+		}
+		else	// the core was woken up by another interrupt
+		{
+			const auto elapsedCounts = suppressedTicks * sysTickPeriod - value;
+			elapsedTicks = elapsedCounts / sysTickPeriod;
+			const auto firstPeriod = (elapsedTicks + 1) * sysTickPeriod - elapsedCounts;
+			restartSysTick(firstPeriod > 1 ? firstPeriod : 2);
+		}
+	}
+
+#if DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+	__set_BASEPRI(basepri);
+#endif	// DISTORTOS_ARCHITECTURE_KERNEL_BASEPRI != 0
+	__set_PRIMASK(primask);
+
+	return elapsedTicks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
@@ -1,12 +1,19 @@
 #
 # file: distortos-sources.cmake
 #
-# author: Copyright (C) 2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #
 
+if(DISTORTOS_ARCHITECTURE_ARMV6_M AND (distortos_Scheduler_15_CPU_time_accounting OR
+		distortos_Scheduler_16_Interrupt_masking_statistics OR distortos_Scheduler_17_Event_trace))
+	message(FATAL_ERROR "ARMv6-M doesn't have DWT cycle counter required by "
+			"distortos_Scheduler_15_CPU_time_accounting, distortos_Scheduler_16_Interrupt_masking_statistics and "
+			"distortos_Scheduler_17_Event_trace")
+endif()
+
 target_include_directories(distortos PUBLIC
 		${CMAKE_CURRENT_LIST_DIR}/include
 		${CMAKE_CURRENT_LIST_DIR}/external/CMSIS)
@@ -15,6 +22,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-architectureLowLevelInitializer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-disableInterruptMasking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-enableInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getCycleCount.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getMainStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-initializeStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-isInInterruptContext.cpp
@@ -23,10 +31,13 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-requestFunctionExecution.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-Reset_Handler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-restoreInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-setStackGuardMpuRegion.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-startScheduling.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-supervisorCall.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-suppressTicks.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SVC_Handler.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-waitForInterrupt.cpp)
 
 doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}
 		INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include ${CMAKE_CURRENT_LIST_DIR}/external/CMSIS
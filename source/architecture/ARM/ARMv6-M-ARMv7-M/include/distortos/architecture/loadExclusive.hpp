@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief loadExclusive() implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_LOADEXCLUSIVE_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_LOADEXCLUSIVE_HPP_
+
+#ifdef __ARM_ARCH_6M__
+#error "ARMv6-M doesn't have exclusive access instructions required for mutex and semaphore fast paths"
+#endif	// def __ARM_ARCH_6M__
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific exclusive load of pointer.
+ *
+ * Loads the pointer and starts exclusive access to it. Exclusive access is lost when any exception is entered or
+ * returned from, so matching storeExclusive() succeeds only if the code between these two calls was not interrupted.
+ *
+ * \param [in] address is the address of loaded pointer
+ *
+ * \return value of pointer at \a address
+ */
+
+inline void* loadExclusive(void* const* const address)
+{
+	return reinterpret_cast<void*>(__LDREXW(reinterpret_cast<volatile uint32_t*>(const_cast<void**>(address))));
+}
+
+/**
+ * \brief Architecture-specific exclusive load of unsigned integer.
+ *
+ * Variant of loadExclusive(void* const*) for unsigned integers.
+ *
+ * \param [in] address is the address of loaded unsigned integer
+ *
+ * \return value of unsigned integer at \a address
+ */
+
+inline unsigned int loadExclusive(const unsigned int* const address)
+{
+	return __LDREXW(reinterpret_cast<volatile uint32_t*>(const_cast<unsigned int*>(address)));
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_LOADEXCLUSIVE_HPP_
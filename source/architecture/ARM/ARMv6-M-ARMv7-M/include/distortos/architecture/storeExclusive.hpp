@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief storeExclusive() implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_STOREEXCLUSIVE_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_STOREEXCLUSIVE_HPP_
+
+#ifdef __ARM_ARCH_6M__
+#error "ARMv6-M doesn't have exclusive access instructions required for mutex and semaphore fast paths"
+#endif	// def __ARM_ARCH_6M__
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific exclusive store of pointer.
+ *
+ * Stores the pointer only if exclusive access started by matching loadExclusive() was not lost in the meantime.
+ *
+ * \param [in] address is the address of stored pointer, must be the same as in matching loadExclusive()
+ * \param [in] value is the new value of pointer at \a address
+ *
+ * \return true if the pointer was stored, false otherwise
+ */
+
+inline bool storeExclusive(void** const address, void* const value)
+{
+	return __STREXW(reinterpret_cast<uintptr_t>(value), reinterpret_cast<volatile uint32_t*>(address)) == 0;
+}
+
+/**
+ * \brief Architecture-specific exclusive store of unsigned integer.
+ *
+ * Variant of storeExclusive(void**, void*) for unsigned integers.
+ *
+ * \param [in] address is the address of stored unsigned integer, must be the same as in matching loadExclusive()
+ * \param [in] value is the new value of unsigned integer at \a address
+ *
+ * \return true if the unsigned integer was stored, false otherwise
+ */
+
+inline bool storeExclusive(unsigned int* const address, const unsigned int value)
+{
+	return __STREXW(value, reinterpret_cast<volatile uint32_t*>(address)) == 0;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_STOREEXCLUSIVE_HPP_
@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \brief RawMemoryPool class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RawMemoryPool.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cassert>
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RawMemoryPool::RawMemoryPool(StorageUniquePointer&& storageUniquePointer, const size_t blockSize,
+		const size_t blocks) :
+		semaphore_{blocks, blocks},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + blockSize * blocks},
+		freeList_{},
+		blockSize_{blockSize}
+{
+	assert(blockSize_ >= sizeof(void*) && blockSize_ % alignof(void*) == 0 && "Invalid block size!");
+	assert(reinterpret_cast<uintptr_t>(storageUniquePointer_.get()) % alignof(void*) == 0 &&
+			"Storage is not aligned!");
+
+	// link all blocks into the list of free blocks, starting from the last one, so that the first one is at the head
+	for (auto block = static_cast<uint8_t*>(storageUniquePointer_.get()) + blockSize_ * blocks;
+			block != storageUniquePointer_.get();)
+	{
+		block -= blockSize_;
+		*reinterpret_cast<void**>(block) = freeList_;
+		freeList_ = block;
+	}
+}
+
+std::pair<int, void*> RawMemoryPool::allocate()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return allocateInternal(semaphoreWaitFunctor);
+}
+
+int RawMemoryPool::deallocate(void* const block)
+{
+	const auto storage = storageUniquePointer_.get();
+	if (block < storage || block >= storageEnd_ ||
+			(static_cast<uint8_t*>(block) - static_cast<uint8_t*>(storage)) % blockSize_ != 0)
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// with interrupt masking enabled, a thread unblocked by posting the semaphore cannot run before the block is on the
+	// list, while the list is not modified if the post fails (e.g. with EOVERFLOW when the block is freed twice)
+	const auto ret = semaphore_.post();
+	if (ret != 0)
+		return ret;
+
+	*static_cast<void**>(block) = freeList_;
+	freeList_ = block;
+	return 0;
+}
+
+std::pair<int, void*> RawMemoryPool::tryAllocate()
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return allocateInternal(semaphoreTryWaitFunctor);
+}
+
+std::pair<int, void*> RawMemoryPool::tryAllocateFor(const TickClock::duration duration)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return allocateInternal(semaphoreTryWaitForFunctor);
+}
+
+std::pair<int, void*> RawMemoryPool::tryAllocateUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return allocateInternal(semaphoreTryWaitUntilFunctor);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> RawMemoryPool::allocateInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor)
+{
+	const auto ret = waitSemaphoreFunctor(semaphore_);
+	if (ret != 0)
+		return {ret, nullptr};
+
+	// successful wait for the semaphore guarantees that the list of free blocks is not empty
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto block = freeList_;
+	freeList_ = *static_cast<void**>(block);
+	return {{}, block};
+}
+
+}	// namespace distortos
@@ -0,0 +1,490 @@
+/**
+ * \file
+ * \brief TlsfHeap class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include <algorithm>
+
+#include <cassert>
+#include <climits>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Aligns value up.
+ *
+ * \param [in] value is the value which will be aligned
+ * \param [in] alignment is the alignment, must be a power of 2
+ *
+ * \return \a value aligned up to \a alignment
+ */
+
+constexpr uintptr_t alignUp(const uintptr_t value, const size_t alignment)
+{
+	return (value + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+}
+
+/**
+ * \param [in] value is the value which will be tested, must not be 0
+ *
+ * \return index of the most significant bit which is set in \a value
+ */
+
+size_t findLastSet(const size_t value)
+{
+	return sizeof(unsigned long long) * CHAR_BIT - 1 - __builtin_clzll(value);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// header of block, directly followed by block's payload
+struct TlsfHeap::Block
+{
+	/// links of free block, placed at the beginning of its payload
+	struct FreeLinks
+	{
+		/// next free block on the same free list, nullptr if this is the last one
+		Block* next;
+
+		/// previous free block on the same free list, nullptr if this is the first one
+		Block* previous;
+	};
+
+	/// size of header, bytes, a multiple of alignment_
+	constexpr static size_t headerSize {(sizeof(Block*) + sizeof(size_t) + alignment_ - 1) / alignment_ * alignment_};
+
+	/// minimal size of payload, bytes, a multiple of alignment_ sufficient to hold FreeLinks
+	constexpr static size_t minimalSize {(sizeof(FreeLinks) + alignment_ - 1) / alignment_ * alignment_};
+
+	/// size of the largest block, bytes
+	constexpr static size_t maximalSize {(size_t{1} << firstLevelIndexMax_) - alignment_};
+
+	/// flag set in sizeAndFlags for free blocks
+	constexpr static size_t freeFlag {1};
+
+	/**
+	 * \brief Converts requested size of memory to size of block's payload.
+	 *
+	 * \param [in] size is the requested size of memory, bytes, must not be greater than maximalSize
+	 *
+	 * \return \a size aligned up to alignment_, not less than minimalSize
+	 */
+
+	static size_t adjustSize(const size_t size)
+	{
+		const auto alignedSize = static_cast<size_t>(alignUp(size, alignment_));
+		return alignedSize < minimalSize ? minimalSize : alignedSize;
+	}
+
+	/**
+	 * \param [in] payload is a pointer to payload of block
+	 *
+	 * \return reference to block with given payload
+	 */
+
+	static Block& fromPayload(const void* const payload)
+	{
+		return *reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(payload) - headerSize);
+	}
+
+	/**
+	 * \return reference to links of free block
+	 */
+
+	FreeLinks& getFreeLinks() const
+	{
+		return *reinterpret_cast<FreeLinks*>(getPayload());
+	}
+
+	/**
+	 * \return reference to block which directly follows this one in memory
+	 */
+
+	Block& getNextPhysical() const
+	{
+		return *reinterpret_cast<Block*>(getPayload() + getSize());
+	}
+
+	/**
+	 * \return pointer to payload of block
+	 */
+
+	uint8_t* getPayload() const
+	{
+		return reinterpret_cast<uint8_t*>(const_cast<Block*>(this)) + headerSize;
+	}
+
+	/**
+	 * \return size of payload of block, bytes
+	 */
+
+	size_t getSize() const
+	{
+		return sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \return true if block is free, false otherwise
+	 */
+
+	bool isFree() const
+	{
+		return (sizeAndFlags & freeFlag) != 0;
+	}
+
+	/**
+	 * \brief Marks block as free or allocated.
+	 *
+	 * \param [in] free selects whether block is free (true) or allocated (false)
+	 */
+
+	void setFree(const bool free)
+	{
+		sizeAndFlags = free == true ? sizeAndFlags | freeFlag : sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \brief Sets size of payload of block.
+	 *
+	 * \param [in] size is the new size of payload of block, bytes, must be a multiple of alignment_
+	 */
+
+	void setSize(const size_t size)
+	{
+		sizeAndFlags = size | (sizeAndFlags & freeFlag);
+	}
+
+	/// previous block in memory, nullptr for the first block
+	Block* previousPhysical;
+
+	/// size of payload of block (bytes) and flags in least significant bits
+	size_t sizeAndFlags;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* TlsfHeap::allocate(const size_t size)
+{
+	if (size > Block::maximalSize)
+		return {};
+
+	const auto adjustedSize = Block::adjustSize(size);
+	const auto block = findFreeBlock(adjustedSize);
+	if (block == nullptr)
+		return {};
+
+	return prepareUsedBlock(*block, adjustedSize);
+}
+
+void* TlsfHeap::allocateAligned(const size_t alignment, const size_t size)
+{
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+		return {};
+
+	if (alignment <= alignment_)
+		return allocate(size);
+
+	// leading part of found block, which is skipped to get required alignment, must form a valid free block
+	const auto minimalGap = Block::headerSize + Block::minimalSize;
+	if (size > Block::maximalSize || alignment > Block::maximalSize ||
+			size + alignment + minimalGap > Block::maximalSize)
+		return {};
+
+	const auto adjustedSize = Block::adjustSize(size);
+	auto block = findFreeBlock(adjustedSize + alignment + minimalGap);
+	if (block == nullptr)
+		return {};
+
+	const auto payload = reinterpret_cast<uintptr_t>(block->getPayload());
+	auto alignedPayload = alignUp(payload, alignment);
+	if (alignedPayload != payload)
+	{
+		while (alignedPayload - payload < minimalGap)
+			alignedPayload += alignment;
+
+		const auto gap = alignedPayload - payload;
+		auto& alignedBlock = Block::fromPayload(reinterpret_cast<void*>(alignedPayload));
+		alignedBlock.previousPhysical = block;
+		alignedBlock.sizeAndFlags = block->getSize() - gap;
+		alignedBlock.getNextPhysical().previousPhysical = &alignedBlock;
+		block->setSize(gap - Block::headerSize);
+		// leading part is surrounded by allocated blocks, so it can be inserted directly
+		insertFreeBlock(*block);
+		block = &alignedBlock;
+	}
+
+	return prepareUsedBlock(*block, adjustedSize);
+}
+
+void TlsfHeap::deallocate(void* const memory)
+{
+	if (memory == nullptr)
+		return;
+
+	auto& block = Block::fromPayload(memory);
+	assert(block.isFree() == false && "Block is already free!");
+	usedSize_ -= block.getSize();
+	--usedBlocks_;
+	releaseBlock(block);
+}
+
+statistics::HeapStatistics TlsfHeap::getStatistics() const
+{
+	size_t largestFreeSize {};
+	if (firstLevelBitmap_ != 0)
+	{
+		// the largest free block is on the last non-empty free list
+		const auto firstLevelIndex = findLastSet(firstLevelBitmap_);
+		const auto secondLevelIndex = findLastSet(secondLevelBitmaps_[firstLevelIndex]);
+		for (auto block = freeLists_[firstLevelIndex][secondLevelIndex]; block != nullptr;
+				block = block->getFreeLinks().next)
+			largestFreeSize = std::max(largestFreeSize, block->getSize());
+	}
+
+	const uint16_t fragmentation = freeSize_ == 0 ? 0 :
+			1000 - static_cast<uint64_t>(largestFreeSize) * 1000 / freeSize_;
+	return {size_, usedSize_, peakUsedSize_, freeSize_, largestFreeSize, usedBlocks_, freeBlocks_, fragmentation};
+}
+
+size_t TlsfHeap::getUsableSize(const void* const memory)
+{
+	return Block::fromPayload(memory).getSize();
+}
+
+bool TlsfHeap::initialize(void* const memory, const size_t size)
+{
+	static_assert(sizeof(Block) <= Block::headerSize, "Invalid size of block's header!");
+	static_assert(Block::minimalSize % alignment_ == 0 && Block::headerSize % alignment_ == 0,
+			"Invalid alignment of block's size!");
+	static_assert(secondLevelCount_ <= sizeof(secondLevelBitmaps_[0]) * CHAR_BIT &&
+			firstLevelCount_ <= sizeof(firstLevelBitmap_) * CHAR_BIT, "Bitmaps are too small!");
+
+	freeLists_ = {};
+	secondLevelBitmaps_ = {};
+	firstLevelBitmap_ = {};
+	size_ = {};
+	usedSize_ = {};
+	peakUsedSize_ = {};
+	freeSize_ = {};
+	usedBlocks_ = {};
+	freeBlocks_ = {};
+
+	const auto begin = alignUp(reinterpret_cast<uintptr_t>(memory), alignment_);
+	const auto end = (reinterpret_cast<uintptr_t>(memory) + size) & ~(static_cast<uintptr_t>(alignment_) - 1);
+	// region must fit the header of the first block, its minimal payload and the header of the sentinel block
+	if (end < begin || end - begin < 2 * Block::headerSize + Block::minimalSize)
+		return false;
+
+	auto& block = *reinterpret_cast<Block*>(begin);
+	block.previousPhysical = {};
+	const auto blockSize = static_cast<size_t>(end - begin - 2 * Block::headerSize);
+	block.sizeAndFlags = blockSize < Block::maximalSize ? blockSize : Block::maximalSize;
+
+	// allocated sentinel block with empty payload terminates the heap, so last block is never merged with memory
+	// outside of the heap
+	auto& sentinel = block.getNextPhysical();
+	sentinel.previousPhysical = &block;
+	sentinel.sizeAndFlags = {};
+
+	size_ = block.getSize();
+	insertFreeBlock(block);
+	return true;
+}
+
+bool TlsfHeap::resize(void* const memory, const size_t size)
+{
+	if (size > Block::maximalSize)
+		return false;
+
+	const auto adjustedSize = Block::adjustSize(size);
+	auto& block = Block::fromPayload(memory);
+	const auto oldSize = block.getSize();
+	if (adjustedSize > oldSize)
+	{
+		auto& nextBlock = block.getNextPhysical();
+		if (nextBlock.isFree() == false || oldSize + Block::headerSize + nextBlock.getSize() < adjustedSize)
+			return false;
+
+		removeFreeBlock(nextBlock);
+		block.setSize(oldSize + Block::headerSize + nextBlock.getSize());
+		block.getNextPhysical().previousPhysical = &block;
+	}
+
+	trimBlock(block, adjustedSize);
+	usedSize_ = usedSize_ - oldSize + block.getSize();
+	peakUsedSize_ = std::max(peakUsedSize_, usedSize_);
+	return true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TlsfHeap::Block* TlsfHeap::findFreeBlock(const size_t size)
+{
+	if (size >= size_t{1} << firstLevelIndexMax_)
+		return {};
+
+	// round size up to the beginning of next free list, so that any block on found list is large enough
+	auto roundedSize = size;
+	if (roundedSize >= size_t{1} << firstLevelShift_)
+		roundedSize += (size_t{1} << (findLastSet(roundedSize) - secondLevelCountLog2_)) - 1;
+
+	if (roundedSize < size_t{1} << firstLevelIndexMax_)
+	{
+		auto indexes = getIndexes(roundedSize);
+		auto secondLevelBitmap = secondLevelBitmaps_[indexes.first] & (UINT32_MAX << indexes.second);
+		if (secondLevelBitmap == 0)
+		{
+			const auto firstLevelBitmap = firstLevelBitmap_ & (UINT32_MAX << (indexes.first + 1));
+			indexes.first = firstLevelBitmap != 0 ? __builtin_ctz(firstLevelBitmap) : firstLevelCount_;
+			secondLevelBitmap = indexes.first < firstLevelCount_ ? secondLevelBitmaps_[indexes.first] : 0;
+		}
+
+		if (secondLevelBitmap != 0)
+		{
+			indexes.second = __builtin_ctz(secondLevelBitmap);
+			const auto block = freeLists_[indexes.first][indexes.second];
+			removeFreeBlock(*block);
+			return block;
+		}
+	}
+
+	// there are no lists with blocks which are surely large enough, but the first block on the list which holds blocks
+	// of requested size may still be large enough - this allows allocation of the whole free memory
+	const auto indexes = getIndexes(size);
+	const auto block = freeLists_[indexes.first][indexes.second];
+	if (block == nullptr || block->getSize() < size)
+		return {};
+
+	removeFreeBlock(*block);
+	return block;
+}
+
+std::pair<size_t, size_t> TlsfHeap::getIndexes(const size_t size)
+{
+	if (size < size_t{1} << firstLevelShift_)
+		return {0, size / alignment_};
+
+	const auto lastSet = findLastSet(size);
+	return {lastSet - firstLevelShift_ + 1, (size >> (lastSet - secondLevelCountLog2_)) - secondLevelCount_};
+}
+
+void TlsfHeap::insertFreeBlock(Block& block)
+{
+	block.setFree(true);
+	const auto indexes = getIndexes(block.getSize());
+	auto& head = freeLists_[indexes.first][indexes.second];
+	auto& freeLinks = block.getFreeLinks();
+	freeLinks.next = head;
+	freeLinks.previous = {};
+	if (head != nullptr)
+		head->getFreeLinks().previous = &block;
+	head = &block;
+	secondLevelBitmaps_[indexes.first] |= UINT32_C(1) << indexes.second;
+	firstLevelBitmap_ |= UINT32_C(1) << indexes.first;
+	freeSize_ += block.getSize();
+	++freeBlocks_;
+}
+
+void* TlsfHeap::prepareUsedBlock(Block& block, const size_t size)
+{
+	trimBlock(block, size);
+	usedSize_ += block.getSize();
+	++usedBlocks_;
+	peakUsedSize_ = std::max(peakUsedSize_, usedSize_);
+	return block.getPayload();
+}
+
+void TlsfHeap::releaseBlock(Block& block)
+{
+	auto mergedBlock = &block;
+	const auto previousBlock = block.previousPhysical;
+	if (previousBlock != nullptr && previousBlock->isFree() == true)
+	{
+		removeFreeBlock(*previousBlock);
+		previousBlock->setSize(previousBlock->getSize() + Block::headerSize + block.getSize());
+		mergedBlock = previousBlock;
+	}
+
+	// sentinel block is never free, so next block always exists
+	auto& nextBlock = mergedBlock->getNextPhysical();
+	if (nextBlock.isFree() == true)
+	{
+		removeFreeBlock(nextBlock);
+		mergedBlock->setSize(mergedBlock->getSize() + Block::headerSize + nextBlock.getSize());
+	}
+
+	mergedBlock->getNextPhysical().previousPhysical = mergedBlock;
+	insertFreeBlock(*mergedBlock);
+}
+
+void TlsfHeap::removeFreeBlock(Block& block)
+{
+	const auto indexes = getIndexes(block.getSize());
+	const auto& freeLinks = block.getFreeLinks();
+	if (freeLinks.next != nullptr)
+		freeLinks.next->getFreeLinks().previous = freeLinks.previous;
+	if (freeLinks.previous != nullptr)
+		freeLinks.previous->getFreeLinks().next = freeLinks.next;
+	else
+	{
+		auto& head = freeLists_[indexes.first][indexes.second];
+		head = freeLinks.next;
+		if (head == nullptr)
+		{
+			secondLevelBitmaps_[indexes.first] &= ~(UINT32_C(1) << indexes.second);
+			if (secondLevelBitmaps_[indexes.first] == 0)
+				firstLevelBitmap_ &= ~(UINT32_C(1) << indexes.first);
+		}
+	}
+
+	block.setFree(false);
+	freeSize_ -= block.getSize();
+	--freeBlocks_;
+}
+
+void TlsfHeap::trimBlock(Block& block, const size_t size)
+{
+	if (block.getSize() < size + Block::headerSize + Block::minimalSize)
+		return;
+
+	auto& remainder = Block::fromPayload(block.getPayload() + size + Block::headerSize);
+	remainder.previousPhysical = &block;
+	remainder.sizeAndFlags = block.getSize() - size - Block::headerSize;
+	block.setSize(size);
+	releaseBlock(remainder);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
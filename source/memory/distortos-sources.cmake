@@ -1,12 +1,31 @@
 #
 # file: distortos-sources.cmake
 #
-# author: Copyright (C) 2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
 #
 
+distortosSetConfiguration(BOOLEAN
+		distortos_Memory_00_TLSF_heap
+		OFF
+		HELP "Use Two-Level Segregated Fit allocator for the heap.
+
+		When this option is enabled, malloc(), free(), realloc(), calloc(), memalign() and related functions from
+		newlib are replaced with a TLSF allocator, which manages the whole heap area defined in linker script (from
+		__heap_start to __heap_end). Allocation, deallocation and resizing in place take bounded time, independent from
+		the number of blocks on the heap, and are done with interrupts masked instead of locking a mutex. Statistics of
+		the heap (including fragmentation and peak usage) are available via distortos::statistics::getHeapStatistics().
+		_sbrk_r() always fails in this configuration.
+
+		Each allocated block has an overhead of one header (8 bytes on 32-bit architectures), all blocks are aligned to
+		alignof(std::max_align_t). Control structure of the allocator occupies about 1.6 kB of RAM."
+		OUTPUT_NAME DISTORTOS_TLSF_HEAP_ENABLE)
+
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/DeferredThreadDeleter.cpp
-		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getTlsfHeap.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RawMemoryPool.cpp
+		${CMAKE_CURRENT_LIST_DIR}/TlsfHeap.cpp)
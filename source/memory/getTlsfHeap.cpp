@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief Main instance of TlsfHeap
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of TlsfHeap
+TlsfHeap tlsfHeapInstance;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
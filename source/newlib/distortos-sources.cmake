@@ -1,7 +1,7 @@
 #
 # file: distortos-sources.cmake
 #
-# author: Copyright (C) 2018-2020 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -14,6 +14,7 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/isatty_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/locking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/lseek_r.cpp
+		${CMAKE_CURRENT_LIST_DIR}/malloc_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/open_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/read_r.cpp
 		${CMAKE_CURRENT_LIST_DIR}/sbrk_r.cpp
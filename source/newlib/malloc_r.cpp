@@ -0,0 +1,230 @@
+/**
+ * \file
+ * \brief Implementation of newlib's memory allocation functions with TlsfHeap
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+extern "C"
+{
+
+/// beginning of heap - imported from linker script
+extern char __heap_start[];
+
+/// end of heap - imported from linker script
+extern char __heap_end[];
+
+}
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Low-level initializer of main instance of TlsfHeap
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER(). The
+ * heap area must be defined explicitly in linker script with symbols __heap_start and __heap_end.
+ */
+
+void tlsfHeapLowLevelInitializer()
+{
+	getTlsfHeap().initialize(__heap_start, __heap_end - __heap_start);
+}
+
+BIND_LOW_LEVEL_INITIALIZER(0, tlsfHeapLowLevelInitializer);
+
+}	// namespace
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates memory.
+ *
+ * See [malloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/malloc.html)
+ *
+ * \param [in] size is the requested size of memory, bytes
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed and sets errno to error code:
+ * - ENOMEM - there is not enough free memory on the heap;
+ */
+
+void* _malloc_r(_reent*, const size_t size)
+{
+	const auto memory = [size]()
+			{
+				const InterruptMaskingLock interruptMaskingLock;
+				return getTlsfHeap().allocate(size);
+			}();
+
+	if (memory == nullptr)
+		errno = ENOMEM;
+	return memory;
+}
+
+/**
+ * \brief Allocates zero-initialized memory for an array.
+ *
+ * See [calloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/calloc.html)
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] elements is the number of elements in array
+ * \param [in] elementSize is the size of single element, bytes
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed and sets errno to error code:
+ * - ENOMEM - size of array overflows or there is not enough free memory on the heap;
+ */
+
+void* _calloc_r(_reent* const reent, const size_t elements, const size_t elementSize)
+{
+	const auto size = elements * elementSize;
+	if (elementSize != 0 && size / elementSize != elements)
+	{
+		errno = ENOMEM;
+		return {};
+	}
+
+	const auto memory = _malloc_r(reent, size);
+	if (memory != nullptr)
+		memset(memory, 0, size);
+	return memory;
+}
+
+/**
+ * \brief Deallocates memory.
+ *
+ * See [free()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/free.html)
+ *
+ * \param [in] memory is a pointer to memory which will be deallocated, nullptr is ignored
+ */
+
+void _free_r(_reent*, void* const memory)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	getTlsfHeap().deallocate(memory);
+}
+
+/**
+ * \param [in] memory is a pointer to allocated memory, may be nullptr
+ *
+ * \return usable size of \a memory (which may be greater than the size requested during allocation), bytes, 0 if
+ * \a memory is nullptr
+ */
+
+size_t _malloc_usable_size_r(_reent*, void* const memory)
+{
+	return memory != nullptr ? TlsfHeap::getUsableSize(memory) : 0;
+}
+
+/**
+ * \brief Allocates aligned memory.
+ *
+ * \param [in] alignment is the requested alignment of memory, bytes, must be a power of 2
+ * \param [in] size is the requested size of memory, bytes
+ *
+ * \return pointer to allocated memory, nullptr if allocation failed and sets errno to error code:
+ * - EINVAL - \a alignment is not a power of 2;
+ * - ENOMEM - there is not enough free memory on the heap;
+ */
+
+void* _memalign_r(_reent*, const size_t alignment, const size_t size)
+{
+	if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+	{
+		errno = EINVAL;
+		return {};
+	}
+
+	const auto memory = [alignment, size]()
+			{
+				const InterruptMaskingLock interruptMaskingLock;
+				return getTlsfHeap().allocateAligned(alignment, size);
+			}();
+
+	if (memory == nullptr)
+		errno = ENOMEM;
+	return memory;
+}
+
+/**
+ * \brief Changes size of allocated memory.
+ *
+ * See [realloc()](https://pubs.opengroup.org/onlinepubs/9699919799/functions/realloc.html)
+ *
+ * If memory cannot be resized in place, new memory is allocated and contents are copied with interrupts unmasked, so
+ * the time during which interrupts are masked does not depend on \a size.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] memory is a pointer to allocated memory, nullptr to allocate new memory
+ * \param [in] size is the new requested size of memory, bytes, 0 to deallocate \a memory
+ *
+ * \return pointer to reallocated memory, nullptr if \a size is 0 or if reallocation failed (\a memory is not changed in
+ * that case) and sets errno to error code:
+ * - ENOMEM - there is not enough free memory on the heap;
+ */
+
+void* _realloc_r(_reent* const reent, void* const memory, const size_t size)
+{
+	if (memory == nullptr)
+		return _malloc_r(reent, size);
+
+	if (size == 0)
+	{
+		_free_r(reent, memory);
+		return {};
+	}
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		if (getTlsfHeap().resize(memory, size) == true)
+			return memory;
+	}
+
+	const auto newMemory = _malloc_r(reent, size);
+	if (newMemory == nullptr)
+		return {};
+
+	const auto oldSize = TlsfHeap::getUsableSize(memory);
+	memcpy(newMemory, memory, oldSize < size ? oldSize : size);
+	_free_r(reent, memory);
+	return newMemory;
+}
+
+}	// extern "C"
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
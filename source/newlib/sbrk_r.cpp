@@ -2,13 +2,15 @@
  * \file
  * \brief _sbrk_r() system call implementation
  *
- * \author Copyright (C) 2014 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/distortosConfiguration.h"
+
 #include <cerrno>
 #include <cstdint>
 
@@ -25,11 +27,23 @@ extern "C"
  * This version of _sbrk_r() requires the heap area to be defined explicitly in linker script with symbols __heap_start
  * and __heap_end.
  *
+ * When DISTORTOS_TLSF_HEAP_ENABLE is enabled, whole heap area is managed by TlsfHeap, so this function always fails.
+ *
  * \param [in] size is the requested data space size
  *
  * \return pointer to new data space
  */
 
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+void* _sbrk_r(_reent*, intptr_t)
+{
+	errno = ENOMEM;
+	return reinterpret_cast<void*>(-1);
+}
+
+#else	// DISTORTOS_TLSF_HEAP_ENABLE != 1
+
 void* _sbrk_r(_reent*, const intptr_t size)
 {
 	extern char __heap_start[];						// imported from linker script
@@ -48,4 +62,6 @@ void* _sbrk_r(_reent*, const intptr_t size)
 	return previousHeapEnd;
 }
 
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE != 1
+
 }	// extern "C"
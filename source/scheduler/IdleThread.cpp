@@ -2,17 +2,31 @@
  * \file
  * \brief Idle thread definition and its low-level initializer
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/internal/scheduler/getIdleThread.hpp"
+
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#elif DISTORTOS_SCHEDULER_IDLE_SLEEP_ENABLE == 1
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_IDLE_SLEEP_ENABLE == 1
+
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/idleHook.h"
 #include "distortos/StaticThread.hpp"
 
 namespace distortos
@@ -31,11 +45,13 @@ void idleThreadFunction();
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /// size of idle thread's stack, bytes
-#ifdef DISTORTOS_THREAD_DETACH_ENABLE
+#if defined(DISTORTOS_THREAD_DETACH_ENABLE)
 constexpr size_t idleThreadStackSize {320};
-#else	// !def DISTORTOS_THREAD_DETACH_ENABLE
+#elif DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+constexpr size_t idleThreadStackSize {192};
+#else	// !defined(DISTORTOS_THREAD_DETACH_ENABLE) && DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE != 1
 constexpr size_t idleThreadStackSize {128};
-#endif	// !def DISTORTOS_THREAD_DETACH_ENABLE
+#endif	// !defined(DISTORTOS_THREAD_DETACH_ENABLE) && DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE != 1
 
 /// type of idle thread
 using IdleThread = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadFunction));
@@ -53,17 +69,28 @@ std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadSt
 
 void idleThreadFunction()
 {
-	volatile uint64_t i {};
-
 	while (1)
 	{
-		++i;
-
 #ifdef DISTORTOS_THREAD_DETACH_ENABLE
 
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def DISTORTOS_THREAD_DETACH_ENABLE
+
+		if (idleHook != nullptr)
+			idleHook();
+
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+		// the core is put to sleep by suppressTicks(), it must not sleep again with "tick" interrupts enabled
+		getScheduler().suppressTicks();
+
+#elif DISTORTOS_SCHEDULER_IDLE_SLEEP_ENABLE == 1
+
+		// if any interrupt makes another thread runnable, context switch is done before the core is put to sleep again
+		architecture::waitForInterrupt();
+
+#endif	// DISTORTOS_SCHEDULER_IDLE_SLEEP_ENABLE == 1
 	}
 }
 
@@ -83,6 +110,15 @@ BIND_LOW_LEVEL_INITIALIZER(20, idleThreadLowLevelInitializer);
 
 }	// namespace
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+Thread& getIdleThread()
+{
+	return reinterpret_cast<IdleThread&>(idleThreadStorage);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
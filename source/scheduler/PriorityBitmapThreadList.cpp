@@ -0,0 +1,150 @@
+/**
+ * \file
+ * \brief PriorityBitmapThreadList class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/PriorityBitmapThreadList.hpp"
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <iterator>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+PriorityBitmapThreadList::iterator PriorityBitmapThreadList::erase(const iterator position)
+{
+	unindex(*position);
+	return ThreadList::erase(position);
+}
+
+PriorityBitmapThreadList::iterator PriorityBitmapThreadList::insert(reference newElement)
+{
+	return link(newElement, false);
+}
+
+void PriorityBitmapThreadList::reposition(const iterator position, const bool loweringBefore)
+{
+	auto& element = *position;
+	erase(position);
+	link(element, loweringBefore);
+}
+
+void PriorityBitmapThreadList::splice(const iterator splicedElement)
+{
+	auto& element = *splicedElement;
+	erase(splicedElement);
+	link(element, false);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int PriorityBitmapThreadList::findOccupied(const uint8_t priority) const
+{
+	size_t word = priority / 32;
+	auto bits = bitmap_[word] & (UINT32_MAX >> priority % 32);
+	if (bits == 0)
+	{
+		const auto words = summary_ & (UINT32_MAX >> (word + 1));
+		if (words == 0)
+			return -1;
+
+		word = __builtin_clz(words);
+		bits = bitmap_[word];
+	}
+
+	return word * 32 + __builtin_clz(bits);
+}
+
+PriorityBitmapThreadList::iterator PriorityBitmapThreadList::link(reference newElement, const bool front)
+{
+	ThreadListNode& node = newElement;
+	const auto priority = node.getEffectivePriority();
+	const auto occupied = tails_[priority] != nullptr;
+
+	// the element will be linked after the last element with priority higher than (or equal to, when linking at the
+	// tail of the group) its own
+	const auto higherPriority = front == false ? findOccupied(priority) :
+			priority != UINT8_MAX ? findOccupied(priority + 1) : -1;
+	auto position = higherPriority < 0 ? begin() : ++iterator{*tails_[higherPriority]};
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	// threads in the group are sorted by deadline - threads which don't use SchedulingPolicy::deadline have the latest
+	// possible deadline, so for them these loops end immediately when linking at the tail of the group
+	if (front == false)
+		while (position != begin() && std::prev(position)->bucketPriority_ == priority &&
+				std::prev(position)->getDeadline() > node.getDeadline())
+			--position;
+	else
+		while (position != end() && position->bucketPriority_ == priority &&
+				position->getDeadline() < node.getDeadline())
+			++position;
+
+	const auto last = position == end() || position->bucketPriority_ != priority;
+
+#else	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE != 1
+
+	const auto last = front == false || occupied == false;
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE != 1
+
+	UnsortedIntrusiveList::insert(position, newElement);
+
+	node.bucketPriority_ = priority;
+	if (last == true)
+		tails_[priority] = &newElement;
+	if (occupied == false)
+	{
+		const auto word = priority / 32;
+		bitmap_[word] |= UINT32_C(1) << (31 - priority % 32);
+		summary_ |= UINT32_C(1) << (31 - word);
+	}
+
+	return iterator{newElement};
+}
+
+void PriorityBitmapThreadList::unindex(reference element)
+{
+	const ThreadListNode& node = element;
+	const auto priority = node.bucketPriority_;
+	if (tails_[priority] != &element)	// element is not the last one in its group or it's not linked in this list
+		return;
+
+	const iterator elementIterator {element};
+	if (elementIterator != begin())
+	{
+		auto& previous = *std::prev(elementIterator);
+		const ThreadListNode& previousNode = previous;
+		if (previousNode.bucketPriority_ == priority)
+		{
+			tails_[priority] = &previous;
+			return;
+		}
+	}
+
+	tails_[priority] = {};
+	const auto word = priority / 32;
+	bitmap_[word] &= ~(UINT32_C(1) << (31 - priority % 32));
+	if (bitmap_[word] == 0)
+		summary_ &= ~(UINT32_C(1) << (31 - word));
+}
+
+}	// namespace internal
+
+}	// namespace distortos
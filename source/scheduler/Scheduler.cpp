@@ -2,7 +2,7 @@
  * \file
  * \brief Scheduler class implementation
  *
- * \author Copyright (C) 2014-2021 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,7 +13,23 @@
 
 #include "distortos/architecture/requestContextSwitch.hpp"
 
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+#include "distortos/architecture/suppressTicks.hpp"
+
+#include <iterator>
+
+#endif	// DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#include "distortos/internal/scheduler/getIdleThread.hpp"
+#include "distortos/internal/scheduler/RunnableThread.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
@@ -161,14 +177,22 @@ int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const
 		return ETIMEDOUT;
 	}
 
-	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
-	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
-	// UnblockReason::timeout.
-	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
+	// This lambda unblocks the thread only if it wasn't already unblocked or moved to another list with requeue() -
+	// this is necessary because double unblock should be avoided (it could mess the order of threads of the same
+	// priority). In that case it also sets UnblockReason::timeout.
+	auto softwareTimer = makeStaticSoftwareTimer([this, iterator, &container]()
 			{
-				if (iterator->getList() != &runnableList_)
+				if (iterator->getList() == &container)
 					unblockInternal(iterator, UnblockReason::timeout);
 			});
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	// timeouts of blocking operations are always handled directly in "tick" interrupt
+	softwareTimer.softwareTimerControlBlock_.setDeferred(false);
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
 	softwareTimer.start(timePoint);
 
 	return block(container, state, unblockFunctor);
@@ -180,6 +204,56 @@ uint64_t Scheduler::getContextSwitchCount() const
 	return contextSwitchCount_;
 }
 
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+uint16_t Scheduler::getCpuLoad(const size_t periods) const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuLoadMeter_.getLoad(periods);
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+uint64_t Scheduler::getCpuTime(const ThreadControlBlock& threadControlBlock) const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (&threadControlBlock != &getCurrentThreadControlBlock())
+		return threadControlBlock.getCpuTime();
+
+	return threadControlBlock.getCpuTime() + cpuTimeCounter_.getElapsed();
+}
+
+uint64_t Scheduler::getCycleCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuTimeCounter_.getCycleCount();
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+uint64_t Scheduler::getDeadlineMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return deadlineMissCount_;
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+uint64_t Scheduler::getIdleTickCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuLoadMeter_.getIdleTicks();
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
 uint64_t Scheduler::getTickCount() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -217,6 +291,14 @@ int Scheduler::remove()
 	return 0;
 }
 
+void Scheduler::requeue(const ThreadList::iterator iterator, ThreadList& container, const ThreadState state)
+{
+	auto& threadControlBlock = *iterator;
+	container.splice(iterator);
+	threadControlBlock.setList(&container);
+	threadControlBlock.setState(state);
+}
+
 int Scheduler::resume(const ThreadList::iterator iterator)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -228,6 +310,35 @@ int Scheduler::resume(const ThreadList::iterator iterator)
 	return 0;
 }
 
+#if DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
+void Scheduler::suppressTicks()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// "tick" interrupts are needed if there are other runnable threads (or if a switch to one of them is pending)
+	if (isContextSwitchRequired() == true || std::next(runnableList_.begin()) != runnableList_.end())
+		return;
+
+	const auto nextTimePoint = softwareTimerSupervisor_.getNextTimePoint().time_since_epoch().count();
+	const auto tickCount = static_cast<TickClock::rep>(tickCount_);
+	if (nextTimePoint - tickCount <= 1)	// nearest software timer will be executed in the next "tick" interrupt
+		return;
+
+	const auto ticks = static_cast<uint64_t>(nextTimePoint - tickCount);
+	const auto suppressedTicks = architecture::suppressTicks(ticks < UINT32_MAX ? ticks : UINT32_MAX);
+	tickCount_ += suppressedTicks;
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+	// all suppressed ticks were spent in idle thread
+	cpuLoadMeter_.add(suppressedTicks, true);
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+}
+
+#endif	// DISTORTOS_SCHEDULER_TICKLESS_IDLE_ENABLE == 1
+
 int Scheduler::suspend()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -244,6 +355,12 @@ void* Scheduler::switchContext(void* const stackPointer)
 {
 	++contextSwitchCount_;
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	getCurrentThreadControlBlock().addCpuTime(cpuTimeCounter_.sample());
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
 	auto& stack = getCurrentThreadControlBlock().getStack();
 
 #ifdef DISTORTOS_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE
@@ -255,6 +372,7 @@ void* Scheduler::switchContext(void* const stackPointer)
 
 	stack.setStackPointer(stackPointer);
 	currentThreadControlBlock_ = runnableList_.begin();
+	traceEvent(TraceEventType::contextSwitch, &getCurrentThreadControlBlock());
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
 }
@@ -272,6 +390,26 @@ bool Scheduler::tickInterruptHandler()
 
 	++tickCount_;
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	// sampling in each "tick" interrupt prevents undetected overflows of core cycle counter
+	getCurrentThreadControlBlock().addCpuTime(cpuTimeCounter_.sample());
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+	const Thread& currentThread = getCurrentThreadControlBlock().getOwner();
+	cpuLoadMeter_.add(1, &currentThread == &getIdleThread());
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	checkDeadline(getCurrentThreadControlBlock());
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
 	// if the object is on the "runnable" list, it uses SchedulingPolicy::roundRobin and it used its round-robin
@@ -331,14 +469,33 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 	if (threadControlBlock.getList() != &runnableList_)
 		return EINVAL;
 
-	container.splice(iterator);
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	// blocking usually ends the job of the thread, so this is the moment when missed deadline can be detected
+	checkDeadline(threadControlBlock);
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	runnableList_.erase(iterator);
+	container.insert(threadControlBlock);
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
+	traceEvent(TraceEventType::block, &threadControlBlock, static_cast<uint8_t>(state));
 
 	return 0;
 }
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+void Scheduler::checkDeadline(ThreadControlBlock& threadControlBlock)
+{
+	if (threadControlBlock.checkDeadline(TickClock::time_point{TickClock::duration{tickCount_}}) == true)
+		++deadlineMissCount_;
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 bool Scheduler::isContextSwitchRequired() const
 {
 	if (getCurrentThreadControlBlock().getList() != &runnableList_)
@@ -357,6 +514,7 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator, const Unblo
 	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 	threadControlBlock.unblockHook(unblockReason);
+	traceEvent(TraceEventType::unblock, &threadControlBlock, static_cast<uint8_t>(unblockReason));
 }
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,13 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+#include "distortos/internal/synchronization/InterruptUnmaskingLock.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
 
 #include "distortos/InterruptMaskingLock.hpp"
 
@@ -28,7 +35,20 @@ namespace internal
 
 void SoftwareTimerControlBlock::run(SoftwareTimerSupervisor& supervisor)
 {
-	functionRunner_(owner_);
+	traceEvent(TraceEventType::softwareTimerExpiry, this);
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	if (deferred_ == true)
+	{
+		const InterruptUnmaskingLock interruptUnmaskingLock;
+		functionRunner_(owner_);
+	}
+	else
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+		functionRunner_(owner_);
 
 	// was timer restarted in timer's function or is this a one-shot timer?
 	if (node.isLinked() == true || period_ == decltype(period_){})
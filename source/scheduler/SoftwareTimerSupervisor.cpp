@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerSupervisor class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -25,11 +25,44 @@ namespace internal
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#if DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE == 1
+
+void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	activeWheel_.insert(softwareTimerControlBlock);
+}
+
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	return activeWheel_.getNextTimePoint();
+}
+
+void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
+{
+	activeWheel_.advance(timePoint);
+
+	// execute all software timers that reached their time point
+	auto& expiredList = activeWheel_.getExpiredList();
+	while (expiredList.empty() == false)
+	{
+		auto& softwareTimer = expiredList.front();
+		expiredList.pop_front();
+		execute(softwareTimer);
+	}
+}
+
+#else	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
 void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
 {
 	activeList_.insert(softwareTimerControlBlock);
 }
 
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	return activeList_.empty() == false ? activeList_.begin()->getTimePoint() : TickClock::time_point::max();
+}
+
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
 	// execute all software timers that reached their time point
@@ -38,10 +71,51 @@ void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point t
 	{
 		auto& softwareTimer = *iterator;
 		SoftwareTimerList::erase(iterator);
+		execute(softwareTimer);
+	}
+}
+
+#endif	// DISTORTOS_SCHEDULER_SOFTWARE_TIMER_WHEEL_ENABLE != 1
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+void SoftwareTimerSupervisor::executeDeferred()
+{
+	deferredSemaphore_.wait();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	// interrupt masking is disabled for execution of each software timer, so the list must be checked each time
+	while (deferredList_.empty() == false)
+	{
+		auto& softwareTimer = deferredList_.front();
+		deferredList_.pop_front();
 		softwareTimer.run(*this);
 	}
 }
 
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerSupervisor::execute(SoftwareTimerControlBlock& softwareTimer)
+{
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	if (softwareTimer.isDeferred() == true)
+	{
+		deferredList_.push_back(softwareTimer);
+		deferredSemaphore_.post();	// EOVERFLOW just means that timer service thread is already being woken up
+		return;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+	softwareTimer.run(*this);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,204 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+
+#include <iterator>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// mask for index of slot in one level
+constexpr uint64_t slotMask {SoftwareTimerWheel::slots - 1};
+
+/// number of bits of expiration time point covered by all levels
+constexpr size_t wheelBits {SoftwareTimerWheel::levelBits * SoftwareTimerWheel::levels};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Finds the earliest expiration time point of software timers on the list.
+ *
+ * \param [in] list is a reference to list of software timers
+ *
+ * \return the earliest expiration time point of software timers on \a list, TickClock::time_point::max() if the list is
+ * empty
+ */
+
+TickClock::time_point findEarliest(const SoftwareTimerWheel::List& list)
+{
+	auto timePoint = TickClock::time_point::max();
+	for (auto& softwareTimer : list)
+		if (softwareTimer.getTimePoint() < timePoint)
+			timePoint = softwareTimer.getTimePoint();
+	return timePoint;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerWheel::advance(const TickClock::time_point timePoint)
+{
+	const auto newTimePoint = timePoint.time_since_epoch().count();
+	while (timePoint_ < newTimePoint)
+	{
+		const auto event = getNextEvent();
+		if (event > static_cast<Ticks>(newTimePoint))	// no more events before new time point?
+		{
+			timePoint_ = newTimePoint;
+			return;
+		}
+
+		timePoint_ = static_cast<TickClock::rep>(event);
+
+		if ((event & ((UINT64_C(1) << wheelBits) - 1)) == 0)
+			redistribute(overflowList_);
+
+		// slots are emptied starting from the highest level, so that cascaded software timers are handled in lower
+		// levels at the same time point
+		for (size_t level {levels}; level > 0; --level)
+		{
+			const auto shift = (level - 1) * levelBits;
+			if ((event & ((UINT64_C(1) << shift) - 1)) != 0)	// not at the beginning of this level's slot?
+				continue;
+
+			const auto slot = (event >> shift) & slotMask;
+			bitmaps_[level - 1] &= ~(UINT32_C(1) << slot);
+			redistribute(slots_[level - 1][slot]);
+		}
+	}
+}
+
+TickClock::time_point SoftwareTimerWheel::getNextTimePoint() const
+{
+	if (expiredList_.empty() == false)
+		return expiredList_.begin()->getTimePoint();
+
+	// software timers in lower levels always expire before software timers in higher levels, the same applies to
+	// slots with higher index in one level
+	for (size_t level {}; level < levels; ++level)
+	{
+		auto bitmap = bitmaps_[level];
+		while (bitmap != 0)
+		{
+			const auto slot = __builtin_ctz(bitmap);
+			const auto timePoint = findEarliest(slots_[level][slot]);
+			if (timePoint != TickClock::time_point::max())
+				return timePoint;
+
+			bitmap &= ~(UINT32_C(1) << slot);
+		}
+	}
+
+	return findEarliest(overflowList_);
+}
+
+void SoftwareTimerWheel::insert(SoftwareTimerControlBlock& softwareTimer)
+{
+	const auto timePoint = softwareTimer.getTimePoint().time_since_epoch().count();
+	if (timePoint <= timePoint_)
+	{
+		insertExpired(softwareTimer);
+		return;
+	}
+
+	const auto difference = static_cast<Ticks>(timePoint) ^ static_cast<Ticks>(timePoint_);
+	size_t level {};
+	while (level < levels && (difference >> (level + 1) * levelBits) != 0)
+		++level;
+
+	if (level == levels)
+	{
+		overflowList_.push_back(softwareTimer);
+		return;
+	}
+
+	const auto slot = (static_cast<Ticks>(timePoint) >> level * levelBits) & slotMask;
+	slots_[level][slot].push_back(softwareTimer);
+	bitmaps_[level] |= UINT32_C(1) << slot;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+SoftwareTimerWheel::Ticks SoftwareTimerWheel::getNextEvent() const
+{
+	const auto timePoint = static_cast<Ticks>(timePoint_);
+
+	// all occupied slots of one level are after the slot of current time point, the slots of a level are emptied
+	// before the beginning of the next slot of the level above it
+	for (size_t level {}; level < levels; ++level)
+	{
+		const auto shift = level * levelBits;
+		const auto slot = (timePoint >> shift) & slotMask;
+		const auto bitmap = bitmaps_[level] & ~((UINT32_C(2) << slot) - 1);
+		if (bitmap != 0)
+		{
+			const auto base = timePoint >> (shift + levelBits) << (shift + levelBits);
+			return base | static_cast<Ticks>(__builtin_ctz(bitmap)) << shift;
+		}
+	}
+
+	if (overflowList_.empty() == false)
+		return ((timePoint >> wheelBits) + 1) << wheelBits;
+
+	return UINT64_MAX;
+}
+
+void SoftwareTimerWheel::insertExpired(SoftwareTimerControlBlock& softwareTimer)
+{
+	// usually the software timer is linked at the end, so the list is searched backwards
+	auto position = expiredList_.end();
+	while (position != expiredList_.begin())
+	{
+		const auto previous = std::prev(position);
+		if (previous->getTimePoint() <= softwareTimer.getTimePoint())
+			break;
+		position = previous;
+	}
+
+	List::insert(position, softwareTimer);
+}
+
+void SoftwareTimerWheel::redistribute(List& list)
+{
+	// the list is moved aside, as software timers may be linked again in the same list
+	List movedList;
+	movedList.swap(list);
+	while (movedList.empty() == false)
+	{
+		auto& softwareTimer = movedList.front();
+		movedList.pop_front();
+		insert(softwareTimer);
+	}
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief Stack class implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -17,6 +17,8 @@
 
 #include <algorithm>
 
+#include <cstdint>
+
 #if DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT <= 0
 #error "Stack alignment must be greater than 0!"
 #endif	// DISTORTOS_ARCHITECTURE_STACK_ALIGNMENT <= 0
@@ -86,6 +88,7 @@ Stack::Stack(StorageUniquePointer&& storageUniquePointer, const size_t size) :
 		storageUniquePointer_{std::move(storageUniquePointer)},
 		adjustedStorage_{adjustStorage(storageUniquePointer_.get(), stackAlignment)},
 		adjustedSize_{adjustSize(storageUniquePointer_.get(), size, adjustedStorage_, stackAlignment)},
+		paintSize_{SIZE_MAX},
 		stackPointer_{}
 {
 
@@ -95,6 +98,7 @@ Stack::Stack(void* const storage, const size_t size) :
 		storageUniquePointer_{storage, dummyDeleter<void*>},
 		adjustedStorage_{storage},
 		adjustedSize_{size},
+		paintSize_{SIZE_MAX},
 		stackPointer_{}
 {
 	/// \todo implement minimal size check
@@ -117,9 +121,8 @@ bool Stack::checkStackGuard() const
 
 size_t Stack::getHighWaterMark() const
 {
-	const auto begin =
-			static_cast<decltype(&stackSentinel)>(adjustedStorage_) + stackGuardSize / sizeof(stackSentinel);
 	const auto end = static_cast<decltype(&stackSentinel)>(adjustedStorage_) + adjustedSize_ / sizeof(stackSentinel);
+	const auto begin = end - getPaintedSize() / sizeof(stackSentinel);
 	const auto usedElement = std::find_if_not(begin, end,
 			[](decltype(stackSentinel)& element) -> bool
 			{
@@ -128,10 +131,24 @@ size_t Stack::getHighWaterMark() const
 	return (end - usedElement) * sizeof(*begin);
 }
 
+size_t Stack::getPaintedSize() const
+{
+	const auto size = getSize();
+	return paintSize_ < size ? paintSize_ / sizeof(stackSentinel) * sizeof(stackSentinel) : size;
+}
+
 int Stack::initialize(RunnableThread& runnableThread)
 {
-	std::fill_n(static_cast<std::decay<decltype(stackSentinel)>::type*>(adjustedStorage_),
-			adjustedSize_ / sizeof(stackSentinel), stackSentinel);
+	const auto storage = static_cast<std::decay<decltype(stackSentinel)>::type*>(adjustedStorage_);
+	const auto paintedSize = getPaintedSize();
+	if (paintedSize == getSize())
+		std::fill_n(storage, adjustedSize_ / sizeof(stackSentinel), stackSentinel);
+	else
+	{
+		std::fill_n(storage, stackGuardSize / sizeof(stackSentinel), stackSentinel);
+		std::fill_n(storage + (adjustedSize_ - paintedSize) / sizeof(stackSentinel),
+				paintedSize / sizeof(stackSentinel), stackSentinel);
+	}
 	int ret;
 	std::tie(ret, stackPointer_) =
 			architecture::initializeStack(static_cast<uint8_t*>(adjustedStorage_) + stackGuardSize, getSize(),
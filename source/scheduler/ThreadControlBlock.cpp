@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -64,6 +64,16 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+				, cpuTime_{}
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+				, contextSwitchCount_{}
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+				, deadlineMissCount_{},
+				deadlineMissed_{}
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 {
 	_REENT_INIT_PTR(&reent_);
 
@@ -87,6 +97,16 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+				, cpuTime_{}
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+				, contextSwitchCount_{}
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+				, deadlineMissCount_{},
+				deadlineMissed_{}
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 {
 	_REENT_INIT_PTR(&reent_);
 
@@ -102,6 +122,9 @@ ThreadControlBlock::~ThreadControlBlock()
 
 	const InterruptMaskingLock interruptMaskingLock;
 
+	// unlink from the list of thread group with interrupts masked, so that the list can be safely traversed
+	threadGroupNode.unlink();
+
 	_reclaim_reent(&reent_);
 }
 
@@ -119,6 +142,30 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+int ThreadControlBlock::setDeadline(const TickClock::time_point deadline)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (schedulingPolicy_ != SchedulingPolicy::deadline)
+		return EINVAL;
+
+	deadlineMissed_ = false;
+
+	if (deadline_ == deadline)
+		return 0;
+
+	deadline_ = deadline;
+
+	if (threadListNode.isLinked() == true)
+		reposition(false);
+
+	return 0;
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -147,6 +194,19 @@ void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPo
 
 	schedulingPolicy_ = schedulingPolicy;
 	roundRobinQuantum_.reset();
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	// deadline is used only with SchedulingPolicy::deadline
+	if (schedulingPolicy == SchedulingPolicy::deadline || deadline_ == TickClock::time_point::max())
+		return;
+
+	deadline_ = TickClock::time_point::max();
+
+	if (threadListNode.isLinked() == true)
+		reposition(false);
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
 }
 
 void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
@@ -195,6 +255,33 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 
 void ThreadControlBlock::reposition(const bool loweringBefore)
 {
+#if DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+	auto& runnableList = getScheduler().getRunnableList();
+	if (list_ == &runnableList)
+	{
+		runnableList.reposition(ThreadList::iterator{*this}, loweringBefore);
+		getScheduler().maybeRequestContextSwitch();
+		return;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_PRIORITY_BITMAP_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	// temporarily earlier deadline places the thread at the head of the group of threads with the same effective
+	// priority and deadline, threads with earlier deadlines stay before it
+	const auto oldDeadline = deadline_;
+
+	if (loweringBefore == true)
+		deadline_ -= TickClock::duration{1};
+
+	list_->splice(ThreadList::iterator{*this});
+
+	deadline_ = oldDeadline;
+
+#else	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE != 1
+
 	const auto oldPriority = priority_;
 
 	if (loweringBefore == true)
@@ -205,6 +292,8 @@ void ThreadControlBlock::reposition(const bool loweringBefore)
 	if (loweringBefore == true)
 		priority_ = oldPriority;
 
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE != 1
+
 	getScheduler().maybeRequestContextSwitch();
 }
 
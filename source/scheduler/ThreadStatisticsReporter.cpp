@@ -0,0 +1,190 @@
+/**
+ * \file
+ * \brief ThreadStatisticsReporter class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ThreadStatisticsReporter.hpp"
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/devices/communication/SerialPort.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/ThisThread.hpp"
+#include "distortos/Thread.hpp"
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdarg>
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts state of thread to its name.
+ *
+ * \param [in] state is the state of thread
+ *
+ * \return name of \a state
+ */
+
+const char* getStateName(const ThreadState state)
+{
+	switch (state)
+	{
+		case ThreadState::created:
+			return "created";
+		case ThreadState::runnable:
+			return "runnable";
+		case ThreadState::terminated:
+			return "terminated";
+		case ThreadState::sleeping:
+			return "sleeping";
+		case ThreadState::blockedOnSemaphore:
+			return "semaphore";
+		case ThreadState::suspended:
+			return "suspended";
+		case ThreadState::blockedOnMutex:
+			return "mutex";
+		case ThreadState::blockedOnConditionVariable:
+			return "condvar";
+		case ThreadState::blockedOnRwLock:
+			return "rwlock";
+		case ThreadState::blockedOnEventFlags:
+			return "eventflags";
+#if DISTORTOS_SIGNALS_ENABLE == 1
+		case ThreadState::waitingForSignal:
+			return "signal";
+#endif	// DISTORTOS_SIGNALS_ENABLE == 1
+		case ThreadState::detached:
+			return "detached";
+	}
+
+	return "?";
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int ThreadStatisticsReporter::report()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const auto threads = statistics::getThreadStatistics(buffer_, size_);
+	const auto reportedThreads = threads < size_ ? threads : size_;
+
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+	uint64_t totalCpuTime {};
+	for (size_t i {}; i < reportedThreads; ++i)
+		totalCpuTime += buffer_[i].cpuTime;
+
+	// prevent overflow of multiplication below
+	auto shift = 0;
+	while ((totalCpuTime >> shift) > UINT64_MAX / 1000)
+		++shift;
+
+	{
+		const auto ret = writeLine("%-10s %7s %-10s %6s %6s %10s %6s\r\n", "thread", "prio", "state", "stack", "used",
+				"switches", "cpu%");
+		if (ret != 0)
+			return ret;
+	}
+
+	for (size_t i {}; i < reportedThreads; ++i)
+	{
+		const auto& threadStatistics = buffer_[i];
+		const auto cpuLoad = (totalCpuTime >> shift) != 0 ?
+				(threadStatistics.cpuTime >> shift) * 1000 / (totalCpuTime >> shift) : 0;
+		const auto ret = writeLine("%10p %3u/%3u %-10s %6zu %6zu %10" PRIu64 " %4u.%u\r\n",
+				static_cast<const void*>(threadStatistics.identifier.getThread()), threadStatistics.priority,
+				threadStatistics.effectivePriority, getStateName(threadStatistics.state), threadStatistics.stackSize,
+				threadStatistics.stackHighWaterMark, threadStatistics.contextSwitchCount,
+				static_cast<unsigned int>(cpuLoad / 10), static_cast<unsigned int>(cpuLoad % 10));
+		if (ret != 0)
+			return ret;
+	}
+
+#else	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE != 1
+
+	{
+		const auto ret = writeLine("%-10s %7s %-10s %6s %6s %10s\r\n", "thread", "prio", "state", "stack", "used",
+				"switches");
+		if (ret != 0)
+			return ret;
+	}
+
+	for (size_t i {}; i < reportedThreads; ++i)
+	{
+		const auto& threadStatistics = buffer_[i];
+		const auto ret = writeLine("%10p %3u/%3u %-10s %6zu %6zu %10" PRIu64 "\r\n",
+				static_cast<const void*>(threadStatistics.identifier.getThread()), threadStatistics.priority,
+				threadStatistics.effectivePriority, getStateName(threadStatistics.state), threadStatistics.stackSize,
+				threadStatistics.stackHighWaterMark, threadStatistics.contextSwitchCount);
+		if (ret != 0)
+			return ret;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE != 1
+
+	if (threads > reportedThreads)
+		return writeLine("%zu more thread(s) not reported\r\n", threads - reportedThreads);
+
+	return writeLine("\r\n");
+}
+
+int ThreadStatisticsReporter::run(const TickClock::duration period)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	auto timePoint = TickClock::now();
+	while (1)
+	{
+		const auto ret = report();
+		if (ret != 0)
+			return ret;
+
+		timePoint += period;
+		ThisThread::sleepUntil(timePoint);
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int ThreadStatisticsReporter::writeLine(const char* const format, ...)
+{
+	char line[80];
+	va_list arguments;
+	va_start(arguments, format);
+	const auto length = vsnprintf(line, sizeof(line), format, arguments);
+	va_end(arguments);
+	if (length < 0)
+		return EINVAL;
+
+	const auto size = static_cast<size_t>(length) < sizeof(line) ? static_cast<size_t>(length) : sizeof(line) - 1;
+	return serialPort_.write(line, size).first;
+}
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief Timer service thread definition and its low-level initializer
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/StaticThread.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+void timerServiceThreadFunction();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of timer service thread
+using TimerServiceThread = decltype(makeStaticThread<DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_STACK_SIZE>(
+		DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_PRIORITY, timerServiceThreadFunction));
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for timer service thread instance
+std::aligned_storage<sizeof(TimerServiceThread), alignof(TimerServiceThread)>::type timerServiceThreadStorage;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Timer service thread's function
+ */
+
+void timerServiceThreadFunction()
+{
+	auto& softwareTimerSupervisor = getScheduler().getSoftwareTimerSupervisor();
+
+	while (1)
+		softwareTimerSupervisor.executeDeferred();
+}
+
+/**
+ * \brief Low-level initializer of timer service thread
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void timerServiceThreadLowLevelInitializer()
+{
+	auto& timerServiceThread = *new (&timerServiceThreadStorage) TimerServiceThread
+			{DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_PRIORITY, timerServiceThreadFunction};
+	timerServiceThread.start();
+}
+
+BIND_LOW_LEVEL_INITIALIZER(20, timerServiceThreadLowLevelInitializer);
+
+}	// namespace
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_SCHEDULER_TIMER_SERVICE_THREAD_ENABLE == 1
@@ -1,7 +1,7 @@
 #
 # file: distortos-sources.cmake
 #
-# author: Copyright (C) 2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -13,13 +13,18 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/getScheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/IdleThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MainThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/PriorityBitmapThreadList.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RoundRobinQuantum.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Scheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerSupervisor.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerWheel.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Stack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/statistics.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadControlBlock.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadStatisticsReporter.cpp
+		${CMAKE_CURRENT_LIST_DIR}/TimerServiceThread.cpp
+		${CMAKE_CURRENT_LIST_DIR}/trace.cpp)
@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,44 @@
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#include "distortos/internal/scheduler/getIdleThread.hpp"
+
+#include "distortos/Thread.hpp"
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#include "distortos/internal/synchronization/InterruptMaskingMonitor.hpp"
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#include "distortos/internal/memory/getTlsfHeap.hpp"
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+
+#include "distortos/Thread.hpp"
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || DISTORTOS_TLSF_HEAP_ENABLE == 1 || \
+		DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1 || DISTORTOS_TLSF_HEAP_ENABLE == 1 ||
+		// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
 namespace distortos
 {
 
@@ -29,6 +67,138 @@ uint64_t getContextSwitchCount()
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+uint16_t getCpuLoad()
+{
+	// idle time is read first, so it never exceeds total time
+	const auto idleTime = getIdleTime();
+	auto totalTime = internal::getScheduler().getCycleCount();
+	auto busyTime = totalTime - idleTime;
+	if (totalTime == 0)
+		return {};
+
+	// prevent overflow of multiplication below
+	while (totalTime > UINT64_MAX / 1000)
+	{
+		totalTime >>= 1;
+		busyTime >>= 1;
+	}
+
+	return busyTime * 1000 / totalTime;
+}
+
+uint64_t getIdleTime()
+{
+	return internal::getIdleThread().getCpuTime();
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+uint16_t getCpuLoad(const size_t periods)
+{
+	return internal::getScheduler().getCpuLoad(periods);
+}
+
+uint64_t getIdleTickCount()
+{
+	return internal::getScheduler().getIdleTickCount();
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_LOAD_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+uint64_t getDeadlineMissCount()
+{
+	return internal::getScheduler().getDeadlineMissCount();
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+#if DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+HeapStatistics getHeapStatistics()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return internal::getTlsfHeap().getStatistics();
+}
+
+#endif	// DISTORTOS_TLSF_HEAP_ENABLE == 1
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+size_t getThreadStatistics(ThreadStatistics* const buffer, const size_t size)
+{
+	size_t count {};
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		auto& scheduler = internal::getScheduler();
+		const auto threadGroupControlBlock = scheduler.getCurrentThreadControlBlock().getThreadGroupControlBlock();
+		threadGroupControlBlock->forEach([buffer, size, &count, &scheduler](
+				const internal::ThreadControlBlock& threadControlBlock)
+				{
+					if (count < size)
+					{
+						auto& threadStatistics = buffer[count];
+						threadStatistics.identifier = {threadControlBlock, threadControlBlock.getSequenceNumber()};
+						threadStatistics.stackSize = threadControlBlock.getStack().getSize();
+						threadStatistics.stackHighWaterMark = {};
+						threadStatistics.contextSwitchCount = threadControlBlock.getContextSwitchCount();
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+						threadStatistics.cpuTime = scheduler.getCpuTime(threadControlBlock);
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+						threadStatistics.priority = threadControlBlock.getPriority();
+						threadStatistics.effectivePriority = threadControlBlock.getEffectivePriority();
+						threadStatistics.state = threadControlBlock.getState();
+					}
+
+					++count;
+				});
+	}
+
+	// stack "high water mark" requires scanning of whole stack, so it is computed with interrupt masking disabled;
+	// the thread may be destroyed while its stack is scanned, so the result is used only if the thread still exists
+	for (size_t i {}; i < count && i < size; ++i)
+	{
+		auto& threadStatistics = buffer[i];
+		const auto thread = threadStatistics.identifier.getThread();
+		if (thread == nullptr)
+			continue;
+
+		const auto stackHighWaterMark = thread->getStackHighWaterMark();
+
+		const InterruptMaskingLock interruptMaskingLock;
+
+		if (threadStatistics.identifier.getThread() == thread)
+			threadStatistics.stackHighWaterMark = stackHighWaterMark;
+	}
+
+	return count;
+}
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+InterruptMaskingStatistics getInterruptMaskingStatistics()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return internal::getInterruptMaskingMonitor().getStatistics();
+}
+
+void resetInterruptMaskingStatistics()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	internal::getInterruptMaskingMonitor().reset();
+}
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
 }	// namespace statistics
 
 }	// namespace distortos
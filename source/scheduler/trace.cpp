@@ -0,0 +1,94 @@
+/**
+ * \file
+ * \brief traceEvent() and trace namespace implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_TRACE_ENABLE == 1
+
+#include "distortos/trace.hpp"
+
+#include "distortos/internal/scheduler/TraceBuffer.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of trace buffer, it may be dumped with debugger and decoded with scripts/traceToChromeJson.py
+TraceBuffer<DISTORTOS_TRACE_BUFFER_SIZE> traceBufferInstance;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Adds record with current value of core cycle counter to trace buffer.
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is the address of object related to the event or a user value
+ * \param [in] argument is the additional argument of the event
+ */
+
+void addRecord(const TraceEventType type, const uint32_t object, const uint8_t argument)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	traceBufferInstance.add(architecture::getCycleCount(), type, object, argument);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void traceEvent(const TraceEventType type, const void* const object, const uint8_t argument)
+{
+	addRecord(type, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(object)), argument);
+}
+
+}	// namespace internal
+
+namespace trace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void mark(const uint32_t value)
+{
+	internal::addRecord(internal::TraceEventType::userMarker, value, {});
+}
+
+void reset()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	internal::traceBufferInstance.reset();
+}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_TRACE_ENABLE == 1
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -30,6 +30,14 @@ void ConditionVariable::notifyAll()
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
+	// "wait morphing" - threads are moved directly to the mutex held by current thread, so that each of them is
+	// unblocked only once, with ownership of the mutex transferred to it; not done for priority inheritance mutexes
+	// (requeued threads wouldn't boost the owner) and priority protect mutexes (priority ceiling wouldn't be checked)
+	if (mutex_ != nullptr && mutex_->getProtocol() == Mutex::Protocol::none &&
+			mutex_->getOwner() == &internal::getScheduler().getCurrentThreadControlBlock())
+		while (blockedList_.empty() == false)
+			mutex_->doRequeue(blockedList_.begin());
+
 	while (blockedList_.empty() == false)
 		internal::getScheduler().unblock(blockedList_.begin());
 }
@@ -51,7 +59,10 @@ int ConditionVariable::wait(Mutex& mutex)
 		if (ret != 0)
 			return ret;
 
+		const auto released = beforeBlock(mutex);
 		internal::getScheduler().block(blockedList_, ThreadState::blockedOnConditionVariable);
+		if (isLockTransferred(mutex, released) == true)
+			return 0;
 	}
 
 	return mutex.lock();
@@ -73,12 +84,33 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
+		const auto released = beforeBlock(mutex);
 		blockUntilRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnConditionVariable,
 				timePoint);
+		if (isLockTransferred(mutex, released) == true)
+			return 0;
 	}
 
 	const auto ret = mutex.lock();
 	return ret != 0 ? ret : blockUntilRet != EINTR ? blockUntilRet : 0;	// don't return EINTR in case of spurious wakeup
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariable::beforeBlock(Mutex& mutex)
+{
+	// different mutexes may be used only if waiting threads are unblocked in between, otherwise "wait morphing" is
+	// disabled until all threads are unblocked
+	mutex_ = blockedList_.empty() == true || mutex_ == &mutex ? &mutex : nullptr;
+	return mutex.getOwner() != &internal::getScheduler().getCurrentThreadControlBlock();
+}
+
+bool ConditionVariable::isLockTransferred(const Mutex& mutex, const bool released)
+{
+	// ownership of mutex which was released can be given to current thread only by transfer of lock
+	return released == true && mutex.getOwner() == &internal::getScheduler().getCurrentThreadControlBlock();
+}
+
 }	// namespace distortos
@@ -0,0 +1,168 @@
+/**
+ * \file
+ * \brief EventFlags class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventFlags.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether the wait is satisfied.
+ *
+ * \param [in] value is the value of event flags
+ * \param [in] mask is the bitmask of flags for which the wait is done
+ * \param [in] all selects whether all (true) or any (false) of flags selected by \a mask must be set
+ *
+ * \return true if the wait is satisfied, false otherwise
+ */
+
+bool isSatisfied(const EventFlags::Value value, const EventFlags::Value mask, const bool all)
+{
+	return all == true ? (value & mask) == mask : (value & mask) != 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+EventFlags::Value EventFlags::clear(const Value mask)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto value = value_;
+	value_ &= ~mask;
+	return value;
+}
+
+EventFlags::Value EventFlags::set(const Value mask)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	value_ |= mask;
+
+	// waiters are removed from the list by their threads, waiters which are already unblocked have empty thread list
+	for (auto& waiter : waitersList_)
+		if (waiter.threadList.empty() == false && isSatisfied(value_, waiter.mask, waiter.all) == true)
+		{
+			waiter.value = value_;
+			if (waiter.autoClear == true)
+				value_ &= ~waiter.mask;
+			internal::getScheduler().unblock(waiter.threadList.begin());
+		}
+
+	return value_;
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAll(const Value mask, const bool autoClear)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return tryWaitInternal(mask, true, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAllFor(const TickClock::duration duration, const Value mask,
+		const bool autoClear)
+{
+	return tryWaitAllUntil(TickClock::now() + duration + TickClock::duration{1}, mask, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAllUntil(const TickClock::time_point timePoint, const Value mask,
+		const bool autoClear)
+{
+	return waitInternal(mask, true, autoClear, &timePoint);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAny(const Value mask, const bool autoClear)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return tryWaitInternal(mask, false, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAnyFor(const TickClock::duration duration, const Value mask,
+		const bool autoClear)
+{
+	return tryWaitAnyUntil(TickClock::now() + duration + TickClock::duration{1}, mask, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAnyUntil(const TickClock::time_point timePoint, const Value mask,
+		const bool autoClear)
+{
+	return waitInternal(mask, false, autoClear, &timePoint);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::waitAll(const Value mask, const bool autoClear)
+{
+	return waitInternal(mask, true, autoClear, nullptr);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::waitAny(const Value mask, const bool autoClear)
+{
+	return waitInternal(mask, false, autoClear, nullptr);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitInternal(const Value mask, const bool all, const bool autoClear)
+{
+	if (mask == 0)
+		return {EINVAL, value_};
+
+	if (isSatisfied(value_, mask, all) == false)
+		return {EAGAIN, value_};
+
+	const auto value = value_;
+	if (autoClear == true)
+		value_ &= ~mask;
+	return {{}, value};
+}
+
+std::pair<int, EventFlags::Value> EventFlags::waitInternal(const Value mask, const bool all, const bool autoClear,
+		const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto tryWaitResult = tryWaitInternal(mask, all, autoClear);
+	if (tryWaitResult.first != EAGAIN)
+		return tryWaitResult;
+
+	Waiter waiter {mask, all, autoClear};
+	waitersList_.push_back(waiter);
+
+	auto& scheduler = internal::getScheduler();
+	const auto ret = timePoint == nullptr ? scheduler.block(waiter.threadList, ThreadState::blockedOnEventFlags) :
+			scheduler.blockUntil(waiter.threadList, ThreadState::blockedOnEventFlags, *timePoint);
+
+	WaitersList::erase(WaitersList::iterator{waiter});
+	return {ret, ret == 0 ? waiter.value : value_};
+}
+
+}	// namespace distortos
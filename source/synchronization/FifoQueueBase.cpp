@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,12 @@
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -31,6 +35,8 @@ FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
 		writePosition_{storageUniquePointer_.get()},
+		popReservations_{},
+		pushReservations_{},
 		elementSize_{elementSize}
 {
 
@@ -41,26 +47,101 @@ FifoQueueBase::~FifoQueueBase()
 
 }
 
+int FifoQueueBase::release(const QueueFunctor& functor, void* const element)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (popReservations_.pending == 0)
+		return EPERM;
+
+	functor(element);
+	return finish(pushSemaphore_, popReservations_);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
-		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
+void FifoQueueBase::advance(void*& storage) const
+{
+	storage = static_cast<uint8_t*>(storage) + elementSize_;
+	if (storage >= storageEnd_)
+		storage = storageUniquePointer_.get();
+}
+
+int FifoQueueBase::finish(Semaphore& postSemaphore, Reservations& reservations)
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
+	if (reservations.pending == 0)
+		return EPERM;
+
+	--reservations.pending;
+	traceEvent(&postSemaphore == &popSemaphore_ ? TraceEventType::queuePush : TraceEventType::queuePop, this);
+	return postFinished(postSemaphore, reservations, 1);
+}
+
+std::pair<int, size_t> FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor,
+		const QueueFunctor& functor, const size_t maxCount, Semaphore& waitSemaphore, Semaphore& postSemaphore,
+		void*& storage, Reservations& reservations)
+{
+	if (maxCount == 0)
+		return {};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
 	const auto ret = waitSemaphoreFunctor(waitSemaphore);
 	if (ret != 0)
-		return ret;
+		return {ret, {}};
+
+	const auto traceEventType =
+			&waitSemaphore == &popSemaphore_ ? TraceEventType::queuePop : TraceEventType::queuePush;
+	size_t count {};
+
+	// only the first element may require waiting, following ones are transferred only if they are available right now
+	do
+	{
+		functor(storage);
+		traceEvent(traceEventType, this);
+		advance(storage);
+		++count;
+	} while (count < maxCount && waitSemaphore.tryWait() == 0);
+
+	return {postFinished(postSemaphore, reservations, count), count};
+}
 
-	functor(storage);
+int FifoQueueBase::postFinished(Semaphore& postSemaphore, Reservations& reservations, const size_t finished)
+{
+	reservations.unposted += finished;
 
-	storage = static_cast<uint8_t*>(storage) + elementSize_;
-	if (storage >= storageEnd_)
-		storage = storageUniquePointer_.get();
+	// slots are published in order, so nothing may be posted while any earlier slot is still reserved
+	if (reservations.pending != 0)
+		return 0;
+
+	while (reservations.unposted != 0)
+	{
+		--reservations.unposted;
+		const auto ret = postSemaphore.post();
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+int FifoQueueBase::start(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& storage,
+		Reservations& reservations, void*& slot)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return ret;
 
-	return postSemaphore.post();
+	slot = storage;
+	advance(storage);
+	++reservations.pending;
+	return 0;
 }
 
 }	// namespace internal
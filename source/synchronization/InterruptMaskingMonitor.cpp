@@ -0,0 +1,99 @@
+/**
+ * \file
+ * \brief InterruptMaskingMonitor class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
+
+#include "distortos/internal/synchronization/InterruptMaskingMonitor.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void InterruptMaskingMonitor::enter(const void* const address)
+{
+	if (depth_++ != 0)	// nested lock?
+		return;
+
+	address_ = address;
+	start_ = architecture::getCycleCount();
+}
+
+void InterruptMaskingMonitor::exit()
+{
+	if (--depth_ != 0)	// nested lock?
+		return;
+
+	record();
+}
+
+uint32_t InterruptMaskingMonitor::pause()
+{
+	const auto depth = depth_;
+	if (depth != 0)
+		record();
+
+	depth_ = 0;
+	return depth;
+}
+
+void InterruptMaskingMonitor::reset()
+{
+	statistics_ = {};
+}
+
+void InterruptMaskingMonitor::resume(const uint32_t depth, const void* const address)
+{
+	depth_ = depth;
+	if (depth == 0)	// interrupt masking was disabled before matching pause()?
+		return;
+
+	address_ = address;
+	start_ = architecture::getCycleCount();
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void InterruptMaskingMonitor::record()
+{
+	const uint32_t duration = architecture::getCycleCount() - start_;
+
+	// bucket 0 - [0; 32), bucket n - [2^(n + 4); 2^(n + 5))
+	const auto log2 = duration != 0 ? 31 - __builtin_clz(duration) : 0;
+	const auto bucket = std::min<size_t>(std::max(log2, 4) - 4, statistics_.histogramBuckets - 1);
+	if (statistics_.histogram[bucket] != UINT32_MAX)
+		++statistics_.histogram[bucket];
+
+	if (duration <= statistics_.worstCaseDuration && statistics_.worstCaseAddress != nullptr)
+		return;
+
+	statistics_.worstCaseAddress = address_;
+	statistics_.worstCaseDuration = duration;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_INTERRUPT_MASKING_STATISTICS_ENABLE == 1
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,12 @@
 
 #include "distortos/internal/synchronization/MessageQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <iterator>
+
 namespace distortos
 {
 
@@ -34,14 +38,18 @@ public:
 	/**
 	 * \brief PopInternalFunctor's constructor
 	 *
-	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
+	 * \param [in,out] priorities is a reference to pointer to array for priorities of popped values (advanced after
+	 * each popped value), nullptr if priorities are not needed
 	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to popping - it will get a
 	 * pointer to storage with element
+	 * \param [in] priorityBuckets is a pointer to index of entry list, nullptr if not used
 	 */
 
-	constexpr PopInternalFunctor(uint8_t& priority, const QueueFunctor& functor) :
-			priority_{priority},
-			functor_{functor}
+	constexpr PopInternalFunctor(uint8_t*& priorities, const QueueFunctor& functor,
+			MessageQueueBase::PriorityBuckets* const priorityBuckets) :
+			priorities_{priorities},
+			functor_{functor},
+			priorityBuckets_{priorityBuckets}
 	{
 
 	}
@@ -60,20 +68,27 @@ public:
 			override
 	{
 		const auto& entry = entryList.front();
-		priority_ = entry.priority;
+		if (priorities_ != nullptr)
+			*priorities_++ = entry.priority;
 
 		functor_(entry.storage);
 
+		if (priorityBuckets_ != nullptr)
+			priorityBuckets_->unlinkFront(entry);
+
 		MessageQueueBase::FreeEntryList::splice_after(freeEntryList.before_begin(), entryList.before_begin());
 	}
 
 private:
 
-	/// reference to variable that will be used to return priority of popped value
-	uint8_t& priority_;
+	/// reference to pointer to array for priorities of popped values, nullptr if priorities are not needed
+	uint8_t*& priorities_;
 
 	/// reference to QueueFunctor which will execute actions related to popping
 	const QueueFunctor& functor_;
+
+	/// pointer to index of entry list, nullptr if not used
+	MessageQueueBase::PriorityBuckets* const priorityBuckets_;
 };
 
 /// PushInternalFunctor class is a MessageQueueBase::InternalFunctor used for pushing of elements to the queue
@@ -87,10 +102,13 @@ public:
 	 * \param [in] priority is the priority of new element
 	 * \param [in] functor is a reference to QueueFunctor which will execute actions related to pushing - it will get a
 	 * pointer to storage for element
+	 * \param [in] priorityBuckets is a pointer to index of entry list, nullptr if not used
 	 */
 
-	constexpr PushInternalFunctor(const uint8_t priority, const QueueFunctor& functor) :
+	constexpr PushInternalFunctor(const uint8_t priority, const QueueFunctor& functor,
+			MessageQueueBase::PriorityBuckets* const priorityBuckets) :
 			functor_{functor},
+			priorityBuckets_{priorityBuckets},
 			priority_{priority}
 	{
 
@@ -114,7 +132,10 @@ public:
 
 		functor_(entry.storage);
 
-		entryList.splice_after(freeEntryList.before_begin());
+		if (priorityBuckets_ == nullptr)
+			entryList.splice_after(freeEntryList.before_begin());
+		else
+			priorityBuckets_->splice(entryList, freeEntryList.before_begin());
 	}
 
 private:
@@ -122,6 +143,9 @@ private:
 	/// reference to QueueFunctor which will execute actions related to pushing
 	const QueueFunctor& functor_;
 
+	/// pointer to index of entry list, nullptr if not used
+	MessageQueueBase::PriorityBuckets* const priorityBuckets_;
+
 	/// priority of new element
 	const uint8_t priority_;
 };
@@ -132,12 +156,45 @@ private:
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void MessageQueueBase::PriorityBuckets::unlinkFront(const Entry& entry)
+{
+	// entry is the first one on the list, so if it's also the last one in its group, the group becomes empty
+	const auto priority = entry.priority;
+	if (tails_[priority] != &entry)
+		return;
+
+	tails_[priority] = {};
+	const auto word = priority / 32;
+	bitmap_[word] &= ~(UINT32_C(1) << (31 - priority % 32));
+	if (bitmap_[word] == 0)
+		summary_ &= ~(UINT32_C(1) << (31 - word));
+}
+
+void MessageQueueBase::PriorityBuckets::splice(EntryList& entryList, const FreeEntryList::iterator beforeSplicedElement)
+{
+	auto& entry = *std::next(beforeSplicedElement);
+	const auto priority = entry.priority;
+	const auto occupied = findOccupied(priority);
+	const auto position = occupied < 0 ? entryList.before_begin() : FreeEntryList::iterator{*tails_[occupied]};
+	FreeEntryList::splice_after(position, beforeSplicedElement);
+
+	if (tails_[priority] == nullptr)
+	{
+		const auto word = priority / 32;
+		bitmap_[word] |= UINT32_C(1) << (31 - priority % 32);
+		summary_ |= UINT32_C(1) << (31 - word);
+	}
+	tails_[priority] = &entry;
+}
+
 MessageQueueBase::MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
-		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements) :
+		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements,
+		PriorityBucketsUniquePointer&& priorityBucketsUniquePointer) :
 		popSemaphore_{0, maxElements},
 		pushSemaphore_{maxElements, maxElements},
 		entryStorageUniquePointer_{std::move(entryStorageUniquePointer)},
 		valueStorageUniquePointer_{std::move(valueStorageUniquePointer)},
+		priorityBucketsUniquePointer_{std::move(priorityBucketsUniquePointer)},
 		entryList_{},
 		freeEntryList_{}
 {
@@ -156,33 +213,85 @@ MessageQueueBase::~MessageQueueBase()
 
 int MessageQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const QueueFunctor& functor)
 {
-	const PopInternalFunctor popInternalFunctor {priority, functor};
-	return popPush(waitSemaphoreFunctor, popInternalFunctor, popSemaphore_, pushSemaphore_);
+	return pop(waitSemaphoreFunctor, &priority, functor, 1).first;
+}
+
+std::pair<int, size_t> MessageQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t* priorities,
+		const QueueFunctor& functor, const size_t maxCount)
+{
+	const PopInternalFunctor popInternalFunctor {priorities, functor, priorityBucketsUniquePointer_.get()};
+	return popPush(waitSemaphoreFunctor, popInternalFunctor, maxCount, popSemaphore_, pushSemaphore_);
 }
 
 int MessageQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const uint8_t priority,
 		const QueueFunctor& functor)
 {
-	const PushInternalFunctor pushInternalFunctor {priority, functor};
-	return popPush(waitSemaphoreFunctor, pushInternalFunctor, pushSemaphore_, popSemaphore_);
+	return push(waitSemaphoreFunctor, priority, functor, 1).first;
+}
+
+std::pair<int, size_t> MessageQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const uint8_t priority,
+		const QueueFunctor& functor, const size_t maxCount)
+{
+	const PushInternalFunctor pushInternalFunctor {priority, functor, priorityBucketsUniquePointer_.get()};
+	return popPush(waitSemaphoreFunctor, pushInternalFunctor, maxCount, pushSemaphore_, popSemaphore_);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-int MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const InternalFunctor& internalFunctor,
-		Semaphore& waitSemaphore, Semaphore& postSemaphore)
+int MessageQueueBase::PriorityBuckets::findOccupied(const uint8_t priority) const
+{
+	size_t word = priority / 32;
+	auto bits = bitmap_[word] & (UINT32_MAX >> priority % 32);
+	if (bits == 0)
+	{
+		const auto words = summary_ & (UINT32_MAX >> (word + 1));
+		if (words == 0)
+			return -1;
+
+		word = __builtin_clz(words);
+		bits = bitmap_[word];
+	}
+
+	return word * 32 + __builtin_clz(bits);
+}
+
+std::pair<int, size_t> MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor,
+		const InternalFunctor& internalFunctor, const size_t maxCount, Semaphore& waitSemaphore,
+		Semaphore& postSemaphore)
 {
+	if (maxCount == 0)
+		return {};
+
 	const InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = waitSemaphoreFunctor(waitSemaphore);
-	if (ret != 0)
-		return ret;
+	{
+		const auto ret = waitSemaphoreFunctor(waitSemaphore);
+		if (ret != 0)
+			return {ret, {}};
+	}
+
+	const auto traceEventType =
+			&waitSemaphore == &popSemaphore_ ? TraceEventType::queuePop : TraceEventType::queuePush;
+	size_t count {};
 
-	internalFunctor(entryList_, freeEntryList_);
+	// only the first element may require waiting, following ones are transferred only if they are available right now
+	do
+	{
+		internalFunctor(entryList_, freeEntryList_);
+		traceEvent(traceEventType, this);
+		++count;
+	} while (count < maxCount && waitSemaphore.tryWait() == 0);
+
+	for (size_t i {}; i < count; ++i)
+	{
+		const auto ret = postSemaphore.post();
+		if (ret != 0)
+			return {ret, count};
+	}
 
-	return postSemaphore.post();
+	return {{}, count};
 }
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief Mutex class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,15 @@ namespace distortos
 
 int Mutex::lock()
 {
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -41,6 +50,15 @@ int Mutex::lock()
 
 int Mutex::tryLock()
 {
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 	const auto ret = tryLockInternal();
 	return ret != EDEADLK ? ret : EBUSY;
@@ -53,6 +71,15 @@ int Mutex::tryLockFor(const TickClock::duration duration)
 
 int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 {
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryFastLock() == true)
+		return 0;
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -68,6 +95,13 @@ int Mutex::unlock()
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	if (tryFastUnlock() == true)
+		return 0;
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (getType() != Type::normal)
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,14 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+#include "distortos/architecture/loadExclusive.hpp"
+#include "distortos/architecture/storeExclusive.hpp"
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
 
 namespace distortos
 {
@@ -119,6 +127,7 @@ void MutexControlBlock::doLock()
 {
 	auto& scheduler = getScheduler();
 	owner_ = &scheduler.getCurrentThreadControlBlock();
+	traceEvent(TraceEventType::mutexLock, this);
 
 	if (getProtocol() == Protocol::none)
 		return;
@@ -129,6 +138,11 @@ void MutexControlBlock::doLock()
 		getOwner()->updateBoostedPriority();
 }
 
+void MutexControlBlock::doRequeue(const ThreadList::iterator iterator)
+{
+	getScheduler().requeue(iterator, blockedList_, ThreadState::blockedOnMutex);
+}
+
 void MutexControlBlock::doUnlockOrTransferLock()
 {
 	auto& oldOwner = *getOwner();
@@ -149,15 +163,61 @@ void MutexControlBlock::doUnlockOrTransferLock()
 	getOwner()->updateBoostedPriority();
 }
 
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+bool MutexControlBlock::tryFastLock()
+{
+	if (getProtocol() == Protocol::priorityProtect)
+		return false;
+
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+	const auto owner = reinterpret_cast<void**>(&owner_);
+	// any context switch between these two calls makes storeExclusive() fail
+	if (architecture::loadExclusive(owner) != nullptr ||
+			architecture::storeExclusive(owner, &currentThreadControlBlock) == false)
+		return false;
+
+	traceEvent(TraceEventType::mutexLock, this);
+	return true;
+}
+
+bool MutexControlBlock::tryFastUnlock()
+{
+	if (getProtocol() == Protocol::priorityProtect)
+		return false;
+
+	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
+	const auto owner = reinterpret_cast<void**>(&owner_);
+	// any context switch between these two calls (e.g. to a thread which blocks on this mutex) makes storeExclusive()
+	// fail
+	if (architecture::loadExclusive(owner) != &currentThreadControlBlock || recursiveLocksCount_ != 0 ||
+			node.isLinked() == true || blockedList_.empty() == false ||
+			architecture::storeExclusive(owner, nullptr) == false)
+		return false;
+
+	traceEvent(TraceEventType::mutexUnlock, this);
+	return true;
+}
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void MutexControlBlock::beforeBlock() const
+void MutexControlBlock::beforeBlock()
 {
 	if (getProtocol() != Protocol::priorityInheritance)
 		return;
 
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	// mutex locked with tryFastLock() is not on the list of mutexes owned by owner thread
+	if (node.isLinked() == false)
+		getOwner()->getOwnedProtocolMutexList().push_front(*this);
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
 	auto& currentThreadControlBlock = getScheduler().getCurrentThreadControlBlock();
 
 	currentThreadControlBlock.setPriorityInheritanceMutexControlBlock(this);
@@ -169,6 +229,7 @@ void MutexControlBlock::beforeBlock() const
 void MutexControlBlock::doTransferLock()
 {
 	owner_ = &blockedList_.front();	// pass ownership to the unblocked thread
+	traceEvent(TraceEventType::mutexTransfer, this);
 	getScheduler().unblock(blockedList_.begin());
 
 	if (node.isLinked() == false)
@@ -183,6 +244,7 @@ void MutexControlBlock::doTransferLock()
 void MutexControlBlock::doUnlock()
 {
 	owner_ = nullptr;
+	traceEvent(TraceEventType::mutexUnlock, this);
 
 	if (node.isLinked() == false)
 		return;
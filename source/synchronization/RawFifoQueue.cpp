@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class implementation
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -37,6 +38,14 @@ RawFifoQueue::RawFifoQueue(StorageUniquePointer&& storageUniquePointer, const si
 
 }
 
+int RawFifoQueue::peek(void*& element)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreWaitFunctor, element);
+}
+
 int RawFifoQueue::pop(void* const buffer, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -45,6 +54,14 @@ int RawFifoQueue::pop(void* const buffer, const size_t size)
 	return popInternal(semaphoreWaitFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::popBatch(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popBatchInternal(semaphoreWaitFunctor, buffer, size);
+}
+
 int RawFifoQueue::push(const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -53,6 +70,44 @@ int RawFifoQueue::push(const void* const data, const size_t size)
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushBatch(const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushBatchInternal(semaphoreWaitFunctor, data, size);
+}
+
+int RawFifoQueue::reserve(void*& slot)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreWaitFunctor, slot);
+}
+
+int RawFifoQueue::tryPeek(void*& element)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreTryWaitFunctor, element);
+}
+
+int RawFifoQueue::tryPeekFor(const TickClock::duration duration, void*& element)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.peek(semaphoreTryWaitForFunctor, element);
+}
+
+int RawFifoQueue::tryPeekUntil(const TickClock::time_point timePoint, void*& element)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.peek(semaphoreTryWaitUntilFunctor, element);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -75,6 +130,30 @@ int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const
 	return popInternal(semaphoreTryWaitUntilFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPopBatch(void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popBatchInternal(semaphoreTryWaitFunctor, buffer, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopBatchFor(const TickClock::duration duration, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popBatchInternal(semaphoreTryWaitForFunctor, buffer, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopBatchUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popBatchInternal(semaphoreTryWaitUntilFunctor, buffer, size);
+}
+
 int RawFifoQueue::tryPush(const void* const data, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -97,6 +176,52 @@ int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void
 	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPushBatch(const void* const data, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushBatchInternal(semaphoreTryWaitFunctor, data, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushBatchFor(const TickClock::duration duration, const void* const data,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushBatchInternal(semaphoreTryWaitForFunctor, data, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushBatchUntil(const TickClock::time_point timePoint, const void* const data,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushBatchInternal(semaphoreTryWaitUntilFunctor, data, size);
+}
+
+int RawFifoQueue::tryReserve(void*& slot)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreTryWaitFunctor, slot);
+}
+
+int RawFifoQueue::tryReserveFor(const TickClock::duration duration, void*& slot)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.reserve(semaphoreTryWaitForFunctor, slot);
+}
+
+int RawFifoQueue::tryReserveUntil(const TickClock::time_point timePoint, void*& slot)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.reserve(semaphoreTryWaitUntilFunctor, slot);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -111,6 +236,23 @@ int RawFifoQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, memcpyPopQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t size)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size % elementSize != 0)
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<uint8_t*>(buffer);
+	const auto memcpyPopFunctor = internal::makeBoundQueueFunctor(
+			[&element, elementSize](void* const storage)
+			{
+				memcpy(element, storage, elementSize);
+				element += elementSize;
+			});
+	return fifoQueueBase_.pop(waitSemaphoreFunctor, memcpyPopFunctor, size / elementSize);
+}
+
 int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
 		const size_t size)
 {
@@ -121,4 +263,21 @@ int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const void* const data, const size_t size)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size % elementSize != 0)
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<const uint8_t*>(data);
+	const auto memcpyPushFunctor = internal::makeBoundQueueFunctor(
+			[&element, elementSize](void* const storage)
+			{
+				memcpy(storage, element, elementSize);
+				element += elementSize;
+			});
+	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushFunctor, size / elementSize);
+}
+
 }	// namespace distortos
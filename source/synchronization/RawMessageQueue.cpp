@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class implementation
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "distortos/RawMessageQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -18,6 +19,8 @@
 #include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
 
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
 #include <cstring>
@@ -33,7 +36,7 @@ namespace distortos
 RawMessageQueue::RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
 		ValueStorageUniquePointer&& valueStorageUniquePointer, const size_t elementSize, const size_t maxElements) :
 		messageQueueBase_{std::move(entryStorageUniquePointer), std::move(valueStorageUniquePointer), elementSize,
-				maxElements},
+				maxElements, {nullptr, internal::dummyDeleter<internal::MessageQueueBase::PriorityBuckets>}},
 		elementSize_{elementSize}
 {
 
@@ -47,6 +50,14 @@ int RawMessageQueue::pop(uint8_t& priority, void* const buffer, const size_t siz
 	return popInternal(semaphoreWaitFunctor, priority, buffer, size);
 }
 
+std::pair<int, size_t> RawMessageQueue::popBatch(uint8_t* const priorities, void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popBatchInternal(semaphoreWaitFunctor, priorities, buffer, size);
+}
+
 int RawMessageQueue::push(const uint8_t priority, const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -55,6 +66,14 @@ int RawMessageQueue::push(const uint8_t priority, const void* const data, const
 	return pushInternal(semaphoreWaitFunctor, priority, data, size);
 }
 
+std::pair<int, size_t> RawMessageQueue::pushBatch(const uint8_t priority, const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushBatchInternal(semaphoreWaitFunctor, priority, data, size);
+}
+
 int RawMessageQueue::tryPop(uint8_t& priority, void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -79,6 +98,30 @@ int RawMessageQueue::tryPopUntil(const TickClock::time_point timePoint, uint8_t&
 	return popInternal(semaphoreTryWaitUntilFunctor, priority, buffer, size);
 }
 
+std::pair<int, size_t> RawMessageQueue::tryPopBatch(uint8_t* const priorities, void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popBatchInternal(semaphoreTryWaitFunctor, priorities, buffer, size);
+}
+
+std::pair<int, size_t> RawMessageQueue::tryPopBatchFor(const TickClock::duration duration, uint8_t* const priorities,
+		void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popBatchInternal(semaphoreTryWaitForFunctor, priorities, buffer, size);
+}
+
+std::pair<int, size_t> RawMessageQueue::tryPopBatchUntil(const TickClock::time_point timePoint,
+		uint8_t* const priorities, void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popBatchInternal(semaphoreTryWaitUntilFunctor, priorities, buffer, size);
+}
+
 int RawMessageQueue::tryPush(const uint8_t priority, const void* const data, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -103,6 +146,30 @@ int RawMessageQueue::tryPushUntil(const TickClock::time_point timePoint, const u
 	return pushInternal(semaphoreTryWaitUntilFunctor, priority, data, size);
 }
 
+std::pair<int, size_t> RawMessageQueue::tryPushBatch(const uint8_t priority, const void* const data, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushBatchInternal(semaphoreTryWaitFunctor, priority, data, size);
+}
+
+std::pair<int, size_t> RawMessageQueue::tryPushBatchFor(const TickClock::duration duration, const uint8_t priority,
+		const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushBatchInternal(semaphoreTryWaitForFunctor, priority, data, size);
+}
+
+std::pair<int, size_t> RawMessageQueue::tryPushBatchUntil(const TickClock::time_point timePoint, const uint8_t priority,
+		const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushBatchInternal(semaphoreTryWaitUntilFunctor, priority, data, size);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -117,6 +184,22 @@ int RawMessageQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphore
 	return messageQueueBase_.pop(waitSemaphoreFunctor, priority, memcpyPopQueueFunctor);
 }
 
+std::pair<int, size_t> RawMessageQueue::popBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		uint8_t* const priorities, void* const buffer, const size_t size)
+{
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<uint8_t*>(buffer);
+	const auto memcpyPopFunctor = internal::makeBoundQueueFunctor(
+			[this, &element](void* const storage)
+			{
+				memcpy(element, storage, elementSize_);
+				element += elementSize_;
+			});
+	return messageQueueBase_.pop(waitSemaphoreFunctor, priorities, memcpyPopFunctor, size / elementSize_);
+}
+
 int RawMessageQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const uint8_t priority,
 		const void* const data, const size_t size)
 {
@@ -127,4 +210,20 @@ int RawMessageQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphor
 	return messageQueueBase_.push(waitSemaphoreFunctor, priority, memcpyPushQueueFunctor);
 }
 
+std::pair<int, size_t> RawMessageQueue::pushBatchInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const uint8_t priority, const void* const data, const size_t size)
+{
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	auto element = static_cast<const uint8_t*>(data);
+	const auto memcpyPushFunctor = internal::makeBoundQueueFunctor(
+			[this, &element](void* const storage)
+			{
+				memcpy(storage, element, elementSize_);
+				element += elementSize_;
+			});
+	return messageQueueBase_.push(waitSemaphoreFunctor, priority, memcpyPushFunctor, size / elementSize_);
+}
+
 }	// namespace distortos
@@ -0,0 +1,189 @@
+/**
+ * \file
+ * \brief RwLock class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RwLock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RwLock::lock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = mutex_.lock();
+	if (ret != 0)
+		return ret;
+
+	return waitForReaders(nullptr);
+}
+
+int RwLock::lockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (preference_ == Preference::readers && readersCount_ != 0)
+	{
+		++readersCount_;
+		return 0;
+	}
+
+	// internal mutex is locked only to wait for exclusive owner (and waiting exclusive owner, if writers are preferred)
+	const auto ret = mutex_.lock();
+	if (ret != 0)
+		return ret;
+
+	++readersCount_;
+	return mutex_.unlock();
+}
+
+int RwLock::tryLock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (readersCount_ != 0 || mutex_.tryLock() != 0)
+		return EBUSY;
+
+	writer_ = &internal::getScheduler().getCurrentThreadControlBlock();
+	return 0;
+}
+
+int RwLock::tryLockFor(const TickClock::duration duration)
+{
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int RwLock::tryLockShared()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (preference_ == Preference::readers && readersCount_ != 0)
+	{
+		++readersCount_;
+		return 0;
+	}
+
+	if (mutex_.tryLock() != 0)
+		return EBUSY;
+
+	++readersCount_;
+	return mutex_.unlock();
+}
+
+int RwLock::tryLockSharedFor(const TickClock::duration duration)
+{
+	return tryLockSharedUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int RwLock::tryLockSharedUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (preference_ == Preference::readers && readersCount_ != 0)
+	{
+		++readersCount_;
+		return 0;
+	}
+
+	const auto ret = mutex_.tryLockUntil(timePoint);
+	if (ret != 0)
+		return ret;
+
+	++readersCount_;
+	return mutex_.unlock();
+}
+
+int RwLock::tryLockUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = mutex_.tryLockUntil(timePoint);
+	if (ret != 0)
+		return ret;
+
+	return waitForReaders(&timePoint);
+}
+
+int RwLock::unlock()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (writer_ != nullptr)
+	{
+		if (writer_ != &internal::getScheduler().getCurrentThreadControlBlock())
+			return EPERM;
+
+		writer_ = {};
+		return mutex_.unlock();
+	}
+
+	if (readersCount_ == 0)
+		return EPERM;
+
+	--readersCount_;
+
+	if (readersCount_ == 0 && writersList_.empty() == false)
+		internal::getScheduler().unblock(writersList_.begin());
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RwLock::waitForReaders(const TickClock::time_point* const timePoint)
+{
+	auto& scheduler = internal::getScheduler();
+
+	// wait is interrupted by signals, so it must be repeated until there are no more shared owners
+	while (readersCount_ != 0)
+	{
+		const auto ret = timePoint == nullptr ? scheduler.block(writersList_, ThreadState::blockedOnRwLock) :
+				scheduler.blockUntil(writersList_, ThreadState::blockedOnRwLock, *timePoint);
+		if (ret == ETIMEDOUT && readersCount_ != 0)
+		{
+			mutex_.unlock();
+			return ret;
+		}
+	}
+
+	writer_ = &scheduler.getCurrentThreadControlBlock();
+	return 0;
+}
+
+}	// namespace distortos
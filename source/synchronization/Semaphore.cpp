@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,13 @@
 
 #include "distortos/InterruptMaskingLock.hpp"
 
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+#include "distortos/architecture/loadExclusive.hpp"
+#include "distortos/architecture/storeExclusive.hpp"
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 #include <cerrno>
 
 namespace distortos
@@ -29,6 +36,13 @@ namespace distortos
 
 int Semaphore::post()
 {
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	if (tryFastPost() == true)
+		return 0;
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (value_ == maxValue_)
@@ -42,11 +56,28 @@ int Semaphore::post()
 
 	++value_;
 
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+	// each waiting thread checks all its semaphores after it is unblocked, nodes of already unblocked threads (which
+	// didn't remove them yet) point to empty lists
+	for (auto& waitForAnyNode : waitForAnyList_)
+		if (waitForAnyNode.threadList->empty() == false)
+			internal::getScheduler().unblock(waitForAnyNode.threadList->begin());
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
 	return 0;
 }
 
 int Semaphore::tryWait()
 {
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	if (tryFastWait() == true)
+		return 0;
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 	return tryWaitInternal();
 }
@@ -60,6 +91,13 @@ int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	if (tryFastWait() == true)
+		return 0;
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	const auto ret = tryWaitInternal();
@@ -73,6 +111,13 @@ int Semaphore::wait()
 {
 	CHECK_FUNCTION_CONTEXT();
 
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	if (tryFastWait() == true)
+		return 0;
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	const auto ret = tryWaitInternal();
@@ -86,6 +131,28 @@ int Semaphore::wait()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+bool Semaphore::tryFastPost()
+{
+	// any exception between these two calls (e.g. context switch to a thread which blocks on this semaphore) makes
+	// storeExclusive() fail
+	const auto value = architecture::loadExclusive(&value_);
+	return value != maxValue_ && blockedList_.empty() == true &&
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+			waitForAnyList_.empty() == true &&
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+			architecture::storeExclusive(&value_, value + 1) == true;
+}
+
+bool Semaphore::tryFastWait()
+{
+	const auto value = architecture::loadExclusive(&value_);
+	return value != 0 && architecture::storeExclusive(&value_, value - 1) == true;
+}
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
 int Semaphore::tryWaitInternal()
 {
 	if (value_ == 0)	// lock not possible?
@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \brief waitForAny() implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/waitForAny.hpp"
+
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> waitForAny(Semaphore* const* const semaphores, WaitForAnyNode* const nodes, const size_t count,
+		const TickClock::time_point* const timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (count == 0)
+		return {EINVAL, {}};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (1)
+	{
+		for (size_t i {}; i < count; ++i)
+			if (semaphores[i]->getValue() != 0)
+				return {{}, i};
+
+		// all nodes point to the same list, so this thread is unblocked only once, even if several semaphores are
+		// posted
+		ThreadList threadList;
+		for (size_t i {}; i < count; ++i)
+		{
+			nodes[i].threadList = &threadList;
+			semaphores[i]->waitForAnyList_.push_back(nodes[i]);
+		}
+
+		auto& scheduler = getScheduler();
+		const auto ret = timePoint == nullptr ? scheduler.block(threadList, ThreadState::blockedOnSemaphore) :
+				scheduler.blockUntil(threadList, ThreadState::blockedOnSemaphore, *timePoint);
+
+		for (size_t i {}; i < count; ++i)
+			WaitForAnyList::erase(WaitForAnyList::iterator{nodes[i]});
+
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
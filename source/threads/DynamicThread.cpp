@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThread class implementation
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -73,6 +73,44 @@ int DynamicThread::generateSignal(const uint8_t signalNumber)
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+uint64_t DynamicThread::getCpuTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getCpuTime();
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+TickClock::time_point DynamicThread::getDeadline() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return TickClock::time_point::max();
+
+	return detachableThread_->getDeadline();
+}
+
+uint32_t DynamicThread::getDeadlineMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getDeadlineMissCount();
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 uint8_t DynamicThread::getEffectivePriority() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -137,6 +175,16 @@ size_t DynamicThread::getStackHighWaterMark() const
 	return detachableThread_->getStackHighWaterMark();
 }
 
+size_t DynamicThread::getStackPaintedSize() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getStackPaintedSize();
+}
+
 size_t DynamicThread::getStackSize() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -183,6 +231,20 @@ int DynamicThread::queueSignal(const uint8_t signalNumber, const sigval value)
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+int DynamicThread::setDeadline(const TickClock::time_point deadline)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->setDeadline(deadline);
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 void DynamicThread::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -203,6 +265,16 @@ void DynamicThread::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 	detachableThread_->setSchedulingPolicy(schedulingPolicy);
 }
 
+int DynamicThread::setStackPaintSize(const size_t paintSize)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return EINVAL;
+
+	return detachableThread_->setStackPaintSize(paintSize);
+}
+
 int DynamicThread::start()
 {
 	const InterruptMaskingLock interruptMaskingLock;
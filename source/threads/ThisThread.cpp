@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace implementation
  *
- * \author Copyright (C) 2014-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -55,6 +55,17 @@ Thread& get()
 	return internal::getScheduler().getCurrentThreadControlBlock().getOwner();
 }
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+TickClock::time_point getDeadline()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getDeadline();
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 uint8_t getEffectivePriority()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -94,6 +105,17 @@ size_t getStackSize()
 	return get().getStackSize();
 }
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+int setDeadline(const TickClock::time_point deadline)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().setDeadline(deadline);
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 void setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	CHECK_FUNCTION_CONTEXT();
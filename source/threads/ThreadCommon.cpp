@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadCommon class header
  *
- * \author Copyright (C) 2015-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -61,6 +61,30 @@ int ThreadCommon::generateSignal(const uint8_t signalNumber)
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+uint64_t ThreadCommon::getCpuTime() const
+{
+	return getScheduler().getCpuTime(getThreadControlBlock());
+}
+
+#endif	// DISTORTOS_SCHEDULER_CPU_TIME_ENABLE == 1
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+TickClock::time_point ThreadCommon::getDeadline() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return getThreadControlBlock().getDeadline();
+}
+
+uint32_t ThreadCommon::getDeadlineMissCount() const
+{
+	return getThreadControlBlock().getDeadlineMissCount();
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 uint8_t ThreadCommon::getEffectivePriority() const
 {
 	return getThreadControlBlock().getEffectivePriority();
@@ -101,6 +125,11 @@ size_t ThreadCommon::getStackHighWaterMark() const
 	return getThreadControlBlock().getStack().getHighWaterMark();
 }
 
+size_t ThreadCommon::getStackPaintedSize() const
+{
+	return getThreadControlBlock().getStack().getPaintedSize();
+}
+
 size_t ThreadCommon::getStackSize() const
 {
 	return getThreadControlBlock().getStack().getSize();
@@ -137,6 +166,15 @@ int ThreadCommon::queueSignal(const uint8_t signalNumber, const sigval value)
 
 #endif	// DISTORTOS_SIGNALS_ENABLE == 1
 
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+int ThreadCommon::setDeadline(const TickClock::time_point deadline)
+{
+	return getThreadControlBlock().setDeadline(deadline);
+}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
 void ThreadCommon::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	getThreadControlBlock().setPriority(priority, alwaysBehind);
@@ -147,6 +185,16 @@ void ThreadCommon::setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 	getThreadControlBlock().setSchedulingPolicy(schedulingPolicy);
 }
 
+int ThreadCommon::setStackPaintSize(const size_t paintSize)
+{
+	auto& threadControlBlock = getThreadControlBlock();
+	if (threadControlBlock.getState() != ThreadState::created)
+		return EINVAL;
+
+	threadControlBlock.getStack().setPaintSize(paintSize);
+	return 0;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | protected functions
 +---------------------------------------------------------------------------------------------------------------------*/
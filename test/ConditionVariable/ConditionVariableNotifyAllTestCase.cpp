@@ -0,0 +1,156 @@
+/**
+ * \file
+ * \brief ConditionVariableNotifyAllTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ConditionVariableNotifyAllTestCase.hpp"
+
+#include "distortos/ConditionVariable.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+#include <tuple>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// timeout used by threads waiting with waitFor(), much longer than duration of the test
+constexpr auto longDuration = std::chrono::seconds{10};
+
+/// number of test threads
+constexpr size_t totalThreads {4};
+
+/// expected number of context switches after unlocking of mutex with "wait morphing": main -> first test thread, then
+/// each test thread terminates and passes the control to the next one, last test thread -> main
+constexpr decltype(statistics::getContextSwitchCount()) morphedContextSwitchCount {totalThreads + 1};
+
+/// priority of test threads
+constexpr uint8_t testThreadPriority {ConditionVariableNotifyAllTestCase::getTestCasePriority() + 1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Runs the test with single mutex.
+ *
+ * \param [in] mutex is a reference to mutex used with condition variable, must be unlocked
+ * \param [in] morphing selects whether "wait morphing" is expected (true) or not (false)
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testMutex(Mutex& mutex, const bool morphing)
+{
+	ConditionVariable conditionVariable;
+	std::array<bool, totalThreads> results {};
+
+	const auto threadFunction = [&conditionVariable, &mutex](bool& result, const bool timed)
+			{
+				const auto lockRet = mutex.lock();
+				const auto waitRet = timed == true ? conditionVariable.waitFor(mutex, longDuration) :
+						conditionVariable.wait(mutex);
+				const auto unlockRet = mutex.unlock();
+				result = lockRet == 0 && waitRet == 0 && unlockRet == 0;
+			};
+
+	std::array<DynamicThread, totalThreads> threads
+	{{
+			makeDynamicThread({testThreadStackSize, testThreadPriority}, threadFunction, std::ref(results[0]), false),
+			makeDynamicThread({testThreadStackSize, testThreadPriority}, threadFunction, std::ref(results[1]), true),
+			makeDynamicThread({testThreadStackSize, testThreadPriority}, threadFunction, std::ref(results[2]), false),
+			makeDynamicThread({testThreadStackSize, testThreadPriority}, threadFunction, std::ref(results[3]), true),
+	}};
+
+	bool ret {true};
+
+	for (auto& thread : threads)
+	{
+		thread.start();
+		ret &= thread.getState() == ThreadState::blockedOnConditionVariable;
+	}
+
+	ret &= mutex.lock() == 0;
+
+	{
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		conditionVariable.notifyAll();
+		if (morphing == true)
+			ret &= statistics::getContextSwitchCount() == contextSwitchCount;
+	}
+
+	for (const auto& thread : threads)
+		ret &= thread.getState() == ThreadState::blockedOnMutex;
+
+	{
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		ret &= mutex.unlock() == 0;
+		if (morphing == true)
+			ret &= statistics::getContextSwitchCount() - contextSwitchCount == morphedContextSwitchCount;
+	}
+
+	for (auto& thread : threads)
+		thread.join();
+
+	for (const auto result : results)
+		ret &= result;
+
+	return ret;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariableNotifyAllTestCase::run_() const
+{
+	using Parameters = std::tuple<Mutex::Type, Mutex::Protocol, uint8_t>;
+	static const std::array<Parameters, 9> parametersArray
+	{{
+			Parameters{Mutex::Type::normal, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::normal, Mutex::Protocol::priorityProtect, UINT8_MAX},
+			Parameters{Mutex::Type::normal, Mutex::Protocol::priorityInheritance, {}},
+			Parameters{Mutex::Type::errorChecking, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::errorChecking, Mutex::Protocol::priorityProtect, UINT8_MAX},
+			Parameters{Mutex::Type::errorChecking, Mutex::Protocol::priorityInheritance, {}},
+			Parameters{Mutex::Type::recursive, Mutex::Protocol::none, {}},
+			Parameters{Mutex::Type::recursive, Mutex::Protocol::priorityProtect, UINT8_MAX},
+			Parameters{Mutex::Type::recursive, Mutex::Protocol::priorityInheritance, {}},
+	}};
+
+	for (const auto& parameters : parametersArray)
+	{
+		Mutex mutex {std::get<0>(parameters), std::get<1>(parameters), std::get<2>(parameters)};
+		if (testMutex(mutex, std::get<1>(parameters) == Mutex::Protocol::none) == false)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief ConditionVariableNotifyAllTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_CONDITIONVARIABLE_CONDITIONVARIABLENOTIFYALLTESTCASE_HPP_
+#define TEST_CONDITIONVARIABLE_CONDITIONVARIABLENOTIFYALLTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests ConditionVariable::notifyAll() with several waiting threads.
+ *
+ * Tests "wait morphing" - threads waiting for condition variable (with wait() and waitFor()) must be moved directly to
+ * the mutex held by notifying thread, without any context switches, and then woken one by one with ownership of the
+ * mutex. Mutexes with priorityInheritance and priorityProtect protocols (for which "wait morphing" is not done) are
+ * tested only for proper operation.
+ */
+
+class ConditionVariableNotifyAllTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief ConditionVariableNotifyAllTestCase's constructor
+	 */
+
+	constexpr ConditionVariableNotifyAllTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_CONDITIONVARIABLE_CONDITIONVARIABLENOTIFYALLTESTCASE_HPP_
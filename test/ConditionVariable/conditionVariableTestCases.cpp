@@ -2,7 +2,7 @@
  * \file
  * \brief conditionVariableTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 
 #include "ConditionVariablePriorityTestCase.hpp"
 #include "ConditionVariableOperationsTestCase.hpp"
+#include "ConditionVariableNotifyAllTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -35,11 +36,15 @@ const ConditionVariablePriorityTestCase priorityTestCase;
 /// ConditionVariableOperationsTestCase instance
 const ConditionVariableOperationsTestCase operationsTestCase;
 
+/// ConditionVariableNotifyAllTestCase instance
+const ConditionVariableNotifyAllTestCase notifyAllTestCase;
+
 /// array with references to TestCase objects related to condition variables
 const TestCaseGroup::Range::value_type conditionVariableTestCases_[]
 {
 		TestCaseGroup::Range::value_type{priorityTestCase},
 		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{notifyAllTestCase},
 };
 
 }	// namespace
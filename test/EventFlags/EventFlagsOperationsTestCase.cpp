@@ -0,0 +1,250 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventFlagsOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/EventFlags.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// return value of EventFlags wait functions
+using WaitResult = std::pair<int, EventFlags::Value>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in phase3(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/// priority of current test thread
+constexpr uint8_t testThreadPriority {EventFlagsOperationsTestCase::getTestCasePriority()};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests all tryWait*() functions in current thread only - they must succeed immediately when required combination of
+ * flags is set and fail (or time-out at expected time) otherwise. Tests also automatic clearing of flags.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	EventFlags eventFlags;
+
+	if (eventFlags.tryWaitAny(0) != WaitResult{EINVAL, 0} || eventFlags.tryWaitAll(0) != WaitResult{EINVAL, 0} ||
+			eventFlags.tryWaitAny(0b1111) != WaitResult{EAGAIN, 0})
+		return false;
+
+	if (eventFlags.set(0b0101) != 0b0101)
+		return false;
+
+	if (eventFlags.tryWaitAll(0b0111) != WaitResult{EAGAIN, 0b0101} ||
+			eventFlags.tryWaitAny(0b0110) != WaitResult{0, 0b0101} ||
+			eventFlags.tryWaitAll(0b0101, true) != WaitResult{0, 0b0101} || eventFlags.get() != 0 ||
+			eventFlags.tryWaitAny(0b0101) != WaitResult{EAGAIN, 0})
+		return false;
+
+	if (eventFlags.set(0b1010) != 0b1010 || eventFlags.clear(0b0010) != 0b1010 || eventFlags.get() != 0b1000)
+		return false;
+
+	{
+		// flags are set, so tryWaitAnyFor() must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = eventFlags.tryWaitAnyFor(singleDuration, 0b1100, true);
+		if (ret != WaitResult{0, 0b1000} || start != TickClock::now() || eventFlags.get() != 0)
+			return false;
+	}
+
+	{
+		// flags are not set, so tryWaitAllFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = eventFlags.tryWaitAllFor(singleDuration, 0b0001);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != WaitResult{ETIMEDOUT, 0} || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// flags are not set, so tryWaitAnyUntil() should time-out at exact expected time
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = eventFlags.tryWaitAnyUntil(requestedTimePoint, 0b0001);
+		if (ret != WaitResult{ETIMEDOUT, 0} || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests unblocking of several threads with single call to set(). Four higher priority threads wait for flags:
+ * - any of 0b0001;
+ * - all of 0b0011;
+ * - any of 0b0010, with automatic clearing;
+ * - any of 0b0010;
+ *
+ * Setting of 0b0001 must unblock only the first thread. Setting of 0b0010 must then unblock second and third thread,
+ * but not the fourth one, as third thread clears the flag which was just set. Setting of 0b0010 once again must unblock
+ * the last thread.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	EventFlags eventFlags;
+	std::array<WaitResult, 4> results {};
+
+	const auto waitFunctor = [&eventFlags](WaitResult& result, const EventFlags::Value mask, const bool all,
+			const bool autoClear)
+			{
+				result = all == true ? eventFlags.waitAll(mask, autoClear) : eventFlags.waitAny(mask, autoClear);
+			};
+
+	constexpr uint8_t threadPriority {testThreadPriority + 1};
+	std::array<DynamicThread, 4> threads
+	{{
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[0]),
+					0b0001, false, false),
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[1]),
+					0b0011, true, false),
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[2]),
+					0b0010, false, true),
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[3]),
+					0b0010, false, false),
+	}};
+
+	bool ret {true};
+
+	for (auto& thread : threads)
+	{
+		thread.start();
+		ret &= thread.getState() == ThreadState::blockedOnEventFlags;
+	}
+
+	ret &= eventFlags.set(0b0001) == 0b0001 && threads[0].getState() == ThreadState::terminated &&
+			threads[1].getState() == ThreadState::blockedOnEventFlags &&
+			threads[2].getState() == ThreadState::blockedOnEventFlags &&
+			threads[3].getState() == ThreadState::blockedOnEventFlags;
+
+	ret &= eventFlags.set(0b0010) == 0b0001 && threads[1].getState() == ThreadState::terminated &&
+			threads[2].getState() == ThreadState::terminated &&
+			threads[3].getState() == ThreadState::blockedOnEventFlags;
+
+	ret &= eventFlags.set(0b0010) == 0b0011 && threads[3].getState() == ThreadState::terminated;
+
+	// make sure all threads are unblocked before they are joined, even if the test failed
+	eventFlags.set(UINT32_MAX);
+
+	for (auto& thread : threads)
+		thread.join();
+
+	return ret == true && results[0] == WaitResult{0, 0b0001} && results[1] == WaitResult{0, 0b0011} &&
+			results[2] == WaitResult{0, 0b0011} && results[3] == WaitResult{0, 0b0011};
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests interrupt-thread signaling scenario. Main (current) thread waits for flags. Software timer is used to set the
+ * flags at specified time point from interrupt context, main thread is expected to be unblocked (with waitAll(),
+ * tryWaitAnyFor() and tryWaitAllUntil()) in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr EventFlags::Value flags {0b1001};
+
+	EventFlags eventFlags;
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&eventFlags, flags]()
+			{
+				eventFlags.set(flags);
+			});
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// flags are not set, but wait should succeed at expected time
+		const auto ret = i == 0 ? eventFlags.waitAll(flags, true) :
+				i == 1 ? eventFlags.tryWaitAnyFor(wakeUpTimePoint - TickClock::now() + longDuration, flags, true) :
+				eventFlags.tryWaitAllUntil(wakeUpTimePoint + longDuration, flags, true);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != WaitResult{0, flags} || wakeUpTimePoint != wokenUpTimePoint || eventFlags.get() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventFlagsOperationsTestCase::run_() const
+{
+	return phase1() == true && phase2() == true && phase3() == true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
+#define TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various EventFlags operations.
+ *
+ * Tests waiting for any and for all flags (waitAny(), waitAll(), tryWait*() functions), automatic clearing of flags,
+ * unblocking of several threads with single call to set() and setting of flags from interrupt context.
+ */
+
+class EventFlagsOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief EventFlagsOperationsTestCase's constructor
+	 */
+
+	constexpr EventFlagsOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_EVENTFLAGS_EVENTFLAGSOPERATIONSTESTCASE_HPP_
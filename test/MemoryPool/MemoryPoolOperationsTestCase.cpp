@@ -0,0 +1,334 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "MemoryPoolOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/internal/memory/memoryPoolDeleter.hpp"
+
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/StaticMemoryPool.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// number of blocks in memory pools used in tests
+constexpr size_t totalBlocks {4};
+
+/// number of elements in queue used in phase3()
+constexpr size_t queueSize {8};
+
+/// expected number of context switches in waitForNextTick(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSwitchCount {2};
+
+/// expected number of context switches in blocking allocation (excluding waitForNextTick()): 1 - main thread blocks on
+/// memory pool (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) blockingContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// memory pool used in phase1() and phase2()
+using TestMemoryPool = StaticMemoryPool<uint64_t, totalBlocks>;
+
+/// memory pool with blocks used as storage for queue in phase3()
+using QueueMemoryPool = StaticRawMemoryPool<sizeof(uint32_t) * queueSize, 1, alignof(uint32_t)>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// memory pool with blocks used as storage for queue in phase3(), must have static storage duration
+QueueMemoryPool queueMemoryPool;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether all blocks can be allocated, whether all tryAllocate*() functions properly return some error when
+ * dealing with empty memory pool, whether invalid blocks are detected by deallocate() and whether deallocation of
+ * already free block fails without corrupting the list of free blocks.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestMemoryPool memoryPool;
+	std::array<void*, totalBlocks> blocks {};
+
+	if (memoryPool.getCapacity() != totalBlocks || memoryPool.getFreeBlocks() != totalBlocks ||
+			memoryPool.getBlockSize() < sizeof(uint64_t) || memoryPool.getBlockSize() % alignof(uint64_t) != 0)
+		return false;
+
+	for (size_t i {}; i < blocks.size(); ++i)
+	{
+		// memory pool is not empty, so tryAllocate() must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0 || ret.second == nullptr || start != TickClock::now() ||
+				reinterpret_cast<uintptr_t>(ret.second) % alignof(uint64_t) != 0 ||
+				memoryPool.getFreeBlocks() != totalBlocks - i - 1)
+			return false;
+		for (size_t j {}; j < i; ++j)
+			if (blocks[j] == ret.second)
+				return false;
+		blocks[i] = ret.second;
+	}
+
+	{
+		// memory pool is empty, so tryAllocate() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != EAGAIN || ret.second != nullptr || start != TickClock::now() ||
+				memoryPool.getFreeBlocks() != 0)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// memory pool is empty, so tryAllocateFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocateFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != nullptr ||
+				realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// memory pool is empty, so tryAllocateUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = memoryPool.tryAllocateUntil(requestedTimePoint);
+		if (ret.first != ETIMEDOUT || ret.second != nullptr || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingContextSwitchCount)
+			return false;
+	}
+
+	{
+		// blocks which were not allocated from this memory pool must be rejected
+		uint64_t foreignBlock;
+		if (memoryPool.deallocate(nullptr) != EINVAL || memoryPool.deallocate(&foreignBlock) != EINVAL ||
+				memoryPool.deallocate(static_cast<uint8_t*>(blocks[0]) + 1) != EINVAL ||
+				memoryPool.getFreeBlocks() != 0)
+			return false;
+	}
+
+	for (size_t i {}; i < blocks.size(); ++i)
+		if (memoryPool.deallocate(blocks[i]) != 0 || memoryPool.getFreeBlocks() != i + 1)
+			return false;
+
+	{
+		// all blocks were deallocated, so the memory pool must be full again
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0 || ret.second == nullptr || memoryPool.getFreeBlocks() != totalBlocks - 1 ||
+				memoryPool.deallocate(ret.second) != 0)
+			return false;
+	}
+
+	{
+		// memory pool is full, so deallocation of already free block must fail and leave the list of free blocks intact
+		if (memoryPool.deallocate(blocks[0]) != EOVERFLOW || memoryPool.getFreeBlocks() != totalBlocks)
+			return false;
+
+		for (size_t i {}; i < blocks.size(); ++i)
+		{
+			const auto ret = memoryPool.tryAllocate();
+			if (ret.first != 0 || ret.second == nullptr)
+				return false;
+			for (size_t j {}; j < i; ++j)
+				if (blocks[j] == ret.second)
+					return false;
+			blocks[i] = ret.second;
+		}
+
+		if (memoryPool.tryAllocate().first != EAGAIN)
+			return false;
+
+		for (const auto block : blocks)
+			if (memoryPool.deallocate(block) != 0)
+				return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt-thread communication scenario. Main (current) thread waits for a block from empty memory pool.
+ * Software timer is used to deallocate a block at specified time point from interrupt context, main thread is expected
+ * to allocate this block (with allocate(), tryAllocateFor() and tryAllocateUntil()) in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestMemoryPool memoryPool;
+	void* block {};
+
+	for (size_t i {}; i < totalBlocks; ++i)
+	{
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0)
+			return false;
+		block = ret.second;
+	}
+
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&memoryPool, &block]()
+			{
+				memoryPool.deallocate(block);
+			});
+
+	using AllocateFunction = std::pair<int, void*>(*)(TestMemoryPool&, TickClock::time_point);
+	const AllocateFunction allocateFunctions[]
+	{
+			[](TestMemoryPool& memoryPoolReference, TickClock::time_point)
+			{
+				return memoryPoolReference.allocate();
+			},
+			[](TestMemoryPool& memoryPoolReference, const TickClock::time_point wakeUpTimePoint)
+			{
+				return memoryPoolReference.tryAllocateFor(wakeUpTimePoint - TickClock::now() + longDuration);
+			},
+			[](TestMemoryPool& memoryPoolReference, const TickClock::time_point wakeUpTimePoint)
+			{
+				return memoryPoolReference.tryAllocateUntil(wakeUpTimePoint + longDuration);
+			},
+	};
+
+	for (const auto allocateFunction : allocateFunctions)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// memory pool is currently empty, but allocation should succeed at expected time
+		const auto ret = allocateFunction(memoryPool, wakeUpTimePoint);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret.first != 0 || ret.second != block || wakeUpTimePoint != wokenUpTimePoint ||
+				memoryPool.getFreeBlocks() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests usage of block allocated from memory pool as storage for queue, which deallocates this block in its destructor
+ * with internal::memoryPoolDeleter().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	{
+		const auto ret = queueMemoryPool.tryAllocate();
+		if (ret.first != 0 || queueMemoryPool.getFreeBlocks() != 0)
+			return false;
+
+		RawFifoQueue rawFifoQueue {{ret.second, internal::memoryPoolDeleter<QueueMemoryPool, queueMemoryPool, void>},
+				sizeof(uint32_t), queueSize};
+
+		for (uint32_t i {}; i < queueSize; ++i)
+			if (rawFifoQueue.tryPush(i) != 0)
+				return false;
+
+		for (uint32_t i {}; i < queueSize; ++i)
+		{
+			uint32_t value {};
+			if (rawFifoQueue.tryPop(value) != 0 || value != i)
+				return false;
+		}
+	}
+
+	// storage of queue must be returned to memory pool
+	return queueMemoryPool.getFreeBlocks() == queueMemoryPool.getCapacity();
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MemoryPoolOperationsTestCase::run_() const
+{
+	constexpr auto phase1ExpectedContextSwitchCount = (totalBlocks + 3) * waitForNextTickContextSwitchCount +
+			2 * blockingContextSwitchCount;
+	constexpr auto phase2ExpectedContextSwitchCount = 3 * waitForNextTickContextSwitchCount +
+			3 * blockingContextSwitchCount;
+	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount;
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
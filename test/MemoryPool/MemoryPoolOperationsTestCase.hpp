@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
+#define TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various memory pool operations.
+ *
+ * Tests allocation (allocate(), tryAllocate*() functions) and deallocation of blocks, detection of invalid blocks,
+ * deallocation from interrupt context and usage of blocks as storage for queues.
+ */
+
+class MemoryPoolOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief MemoryPoolOperationsTestCase's constructor
+	 */
+
+	constexpr MemoryPoolOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MEMORYPOOL_MEMORYPOOLOPERATIONSTESTCASE_HPP_
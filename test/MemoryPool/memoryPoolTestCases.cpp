@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief memoryPoolTestCases object definition
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "memoryPoolTestCases.hpp"
+
+#include "MemoryPoolOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// MemoryPoolOperationsTestCase instance
+const MemoryPoolOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to memory pools
+const TestCaseGroup::Range::value_type memoryPoolTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup memoryPoolTestCases {TestCaseGroup::Range{memoryPoolTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
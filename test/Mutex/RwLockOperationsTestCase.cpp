@@ -0,0 +1,281 @@
+/**
+ * \file
+ * \brief RwLockOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "RwLockOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/RwLock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// priority of current test thread
+constexpr uint8_t testThreadPriority {RwLockOperationsTestCase::getTestCasePriority()};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests locking and unlocking in current thread only. Locking in shared mode must succeed when the RwLock is unlocked
+ * or locked in shared mode, all other attempts must fail or time-out at expected time. Attempt to lock in exclusive
+ * mode when the RwLock is locked in shared mode by current thread must time-out (current thread waits for itself), but
+ * after the timeout the RwLock must still be available in shared mode.
+ *
+ * \param [in] preference is the preference of lock
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1(const RwLock::Preference preference)
+{
+	RwLock rwLock {preference};
+
+	if (rwLock.unlock() != EPERM)
+		return false;
+
+	for (size_t i {}; i < 2; ++i)
+	{
+		// RwLock is unlocked or locked in shared mode, so tryLockShared() must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = rwLock.tryLockShared();
+		if (ret != 0 || start != TickClock::now())
+			return false;
+	}
+
+	if (rwLock.tryLock() != EBUSY)
+		return false;
+
+	{
+		// RwLock is locked in shared mode, so tryLockFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = rwLock.tryLockFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// exclusive lock attempt timed-out, so RwLock must still be available in shared mode
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = rwLock.tryLockSharedFor(singleDuration);
+		if (ret != 0 || start != TickClock::now())
+			return false;
+	}
+
+	for (size_t i {}; i < 3; ++i)
+		if (rwLock.unlock() != 0)
+			return false;
+
+	if (rwLock.unlock() != EPERM)
+		return false;
+
+	{
+		// RwLock is unlocked, so tryLockUntil() must succeed immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = rwLock.tryLockUntil(start + singleDuration);
+		if (ret != 0 || start != TickClock::now())
+			return false;
+	}
+
+	if (rwLock.tryLock() != EBUSY || rwLock.tryLockShared() != EBUSY)
+		return false;
+
+	{
+		// RwLock is locked in exclusive mode, so tryLockSharedUntil() should time-out at exact expected time
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = rwLock.tryLockSharedUntil(requestedTimePoint);
+		if (ret != ETIMEDOUT || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	return rwLock.unlock() == 0 && rwLock.unlock() == EPERM;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests waiting of exclusive owner for shared owners. RwLock is locked in shared mode by current thread, then higher
+ * priority thread tries to lock it in exclusive mode - it must be blocked until the RwLock is unlocked by current
+ * thread. While exclusive owner waits, locking in shared mode must be possible only when readers are preferred.
+ *
+ * \param [in] preference is the preference of lock
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2(const RwLock::Preference preference)
+{
+	RwLock rwLock {preference};
+	int sharedRet {-1};
+
+	if (rwLock.lockShared() != 0)
+		return false;
+
+	auto thread = makeDynamicThread({testThreadStackSize, static_cast<uint8_t>(testThreadPriority + 1)},
+			[&rwLock, &sharedRet]()
+			{
+				sharedRet = rwLock.lock();
+				if (sharedRet == 0)
+					sharedRet = rwLock.unlock();
+			});
+
+	thread.start();
+	if (thread.getState() != ThreadState::blockedOnRwLock)
+	{
+		rwLock.unlock();
+		thread.join();
+		return false;
+	}
+
+	const auto tryLockSharedRet = rwLock.tryLockShared();
+	if (tryLockSharedRet == 0)
+		rwLock.unlock();
+
+	const auto blockedState = thread.getState();
+	const auto unlockRet = rwLock.unlock();
+	const auto terminatedState = thread.getState();
+	thread.join();
+
+	const auto expectedTryLockSharedRet = preference == RwLock::Preference::readers ? 0 : EBUSY;
+	return tryLockSharedRet == expectedTryLockSharedRet && blockedState == ThreadState::blockedOnRwLock &&
+			unlockRet == 0 && terminatedState == ThreadState::terminated && sharedRet == 0 &&
+			rwLock.tryLock() == 0 && rwLock.unlock() == 0;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests priority inheritance towards exclusive owner. RwLock is locked in exclusive mode by lower priority thread, then
+ * higher priority threads try to lock it in shared and in exclusive mode - exclusive owner must inherit the priority of
+ * the highest priority waiting thread, and it must return to its own priority after unlocking.
+ *
+ * \param [in] preference is the preference of lock
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3(const RwLock::Preference preference)
+{
+	constexpr uint8_t writerPriority {testThreadPriority - 1};
+	constexpr uint8_t readerPriority {testThreadPriority + 1};
+
+	RwLock rwLock {preference};
+	Semaphore semaphore {0};
+	int writerRet {-1};
+	int readerRet {-1};
+
+	auto writerThread = makeDynamicThread({testThreadStackSize, writerPriority},
+			[&rwLock, &semaphore, &writerRet]()
+			{
+				writerRet = rwLock.lock();
+				if (writerRet != 0)
+					return;
+
+				semaphore.wait();
+				writerRet = rwLock.unlock();
+			});
+	auto readerThread = makeDynamicThread({testThreadStackSize, readerPriority},
+			[&rwLock, &readerRet]()
+			{
+				readerRet = rwLock.lockShared();
+				if (readerRet == 0)
+					readerRet = rwLock.unlock();
+			});
+
+	writerThread.start();
+	// let lower priority thread lock the RwLock and block on semaphore
+	ThisThread::sleepFor(singleDuration);
+
+	bool ret {writerThread.getState() == ThreadState::blockedOnSemaphore};
+
+	{
+		// current thread blocks on the RwLock until timeout, then exclusive owner must return to its own priority
+		const auto tryLockForRet = rwLock.tryLockFor(singleDuration);
+		ret &= tryLockForRet == ETIMEDOUT && writerThread.getEffectivePriority() == writerPriority;
+	}
+
+	readerThread.start();
+	ret &= readerThread.getState() == ThreadState::blockedOnMutex &&
+			writerThread.getEffectivePriority() == readerPriority;
+
+	// exclusive owner is woken up with inherited priority, it unlocks the RwLock and higher priority thread acquires it
+	// in shared mode, then unlocks it - only then current thread continues
+	semaphore.post();
+	ret &= writerThread.getEffectivePriority() == writerPriority && readerThread.getState() == ThreadState::terminated;
+
+	const auto tryLockRet = rwLock.tryLock();
+	const auto unlockRet = tryLockRet == 0 ? rwLock.unlock() : tryLockRet;
+
+	readerThread.join();
+	writerThread.join();
+
+	return ret == true && writerRet == 0 && readerRet == 0 && tryLockRet == 0 && unlockRet == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RwLockOperationsTestCase::run_() const
+{
+	for (const auto preference : {RwLock::Preference::readers, RwLock::Preference::writers})
+	{
+		const auto ret1 = phase1(preference);
+		if (ret1 != true)
+			return ret1;
+
+		const auto ret2 = phase2(preference);
+		if (ret2 != true)
+			return ret2;
+
+		const auto ret3 = phase3(preference);
+		if (ret3 != true)
+			return ret3;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
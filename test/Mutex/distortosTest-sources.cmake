@@ -1,7 +1,7 @@
 #
 # file: distortosTest-sources.cmake
 #
-# author: Copyright (C) 2018 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -15,6 +15,7 @@ target_sources(distortosTest PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/MutexPriorityProtocolTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexPriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexRecursiveOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RwLockOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/mutexTestCases.cpp
 		${CMAKE_CURRENT_LIST_DIR}/mutexTestTryLockWhenLocked.cpp
 		${CMAKE_CURRENT_LIST_DIR}/mutexTestUnlockFromWrongThread.cpp)
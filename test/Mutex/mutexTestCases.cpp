@@ -2,7 +2,7 @@
  * \file
  * \brief mutexTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,7 @@
 #include "MutexPriorityProtectOperationsTestCase.hpp"
 #include "MutexPriorityInheritanceOperationsTestCase.hpp"
 #include "MutexPriorityProtocolTestCase.hpp"
+#include "RwLockOperationsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -55,6 +56,9 @@ const MutexPriorityInheritanceOperationsTestCase priorityInheritanceOperationsTe
 /// MutexPriorityProtocolTestCase instance
 const MutexPriorityProtocolTestCase priorityProtocolTestCase;
 
+/// RwLockOperationsTestCase instance
+const RwLockOperationsTestCase rwLockOperationsTestCase;
+
 /// array with references to TestCase objects related to mutexes
 const TestCaseGroup::Range::value_type mutexTestCases_[]
 {
@@ -65,6 +69,7 @@ const TestCaseGroup::Range::value_type mutexTestCases_[]
 		TestCaseGroup::Range::value_type{priorityProtectOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityInheritanceOperationsTestCase},
 		TestCaseGroup::Range::value_type{priorityProtocolTestCase},
+		TestCaseGroup::Range::value_type{rwLockOperationsTestCase},
 };
 
 }	// namespace
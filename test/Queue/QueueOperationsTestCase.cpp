@@ -2,7 +2,7 @@
  * \file
  * \brief QueueOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -15,6 +15,11 @@
 
 #include "waitForNextTick.hpp"
 
+#include "distortos/DynamicMessageQueue.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
@@ -1163,6 +1168,225 @@ bool phase6()
 	return true;
 }
 
+/**
+ * \brief Phase 7 of test case.
+ *
+ * Tests zero-copy operations of FIFO queues - element in reserved slot must become available only after all outstanding
+ * reservations are committed, slot of peeked element must become free only after all outstanding peeks are released,
+ * commit() and release() must fail with EPERM when there is nothing to finish (without destructing the element).
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase7()
+{
+	{
+		StaticRawFifoQueue<sizeof(uint32_t), 2> rawFifoQueue;
+		if (rawFifoQueue.commit() != EPERM || rawFifoQueue.release() != EPERM)
+			return false;
+
+		void* slot;
+		if (rawFifoQueue.tryReserve(slot) != 0)
+			return false;
+		*static_cast<uint32_t*>(slot) = 1;
+		if (rawFifoQueue.tryPush(uint32_t{2}) != 0)
+			return false;
+
+		uint32_t value;
+		// nothing is published while the reservation is outstanding
+		if (rawFifoQueue.tryPop(value) != EAGAIN || rawFifoQueue.tryReserve(slot) != EAGAIN)
+			return false;
+		if (rawFifoQueue.commit() != 0)
+			return false;
+
+		void* element;
+		if (rawFifoQueue.tryPeek(element) != 0 || *static_cast<uint32_t*>(element) != 1)
+			return false;
+		if (rawFifoQueue.tryPop(value) != 0 || value != 2)
+			return false;
+		// no slot is freed while the peek is outstanding
+		if (rawFifoQueue.tryPush(uint32_t{3}) != EAGAIN)
+			return false;
+		if (rawFifoQueue.release() != 0 || rawFifoQueue.release() != EPERM)
+			return false;
+		if (rawFifoQueue.tryPush(uint32_t{3}) != 0 || rawFifoQueue.tryPush(uint32_t{4}) != 0)
+			return false;
+		if (rawFifoQueue.tryPop(value) != 0 || value != 3 || rawFifoQueue.tryPop(value) != 0 || value != 4)
+			return false;
+	}
+
+	{
+		StaticFifoQueue<uint32_t, 1> fifoQueue;
+
+		void* slot;
+		if (fifoQueue.tryReserve(slot) != 0)
+			return false;
+		new (slot) uint32_t{5};
+		if (fifoQueue.commit() != 0 || fifoQueue.commit() != EPERM)
+			return false;
+
+		uint32_t* element;
+		if (fifoQueue.tryPeek(element) != 0 || *element != 5)
+			return false;
+		if (fifoQueue.release(*element) != 0 || fifoQueue.tryPeek(element) != EAGAIN)
+			return false;
+	}
+
+	{
+		StaticFifoQueue<OperationCountingType, 1> fifoQueue;
+
+		OperationCountingType::resetCounters();
+		OperationCountingType value {};	// 1 construction
+		// element must not be destructed when there is no outstanding peek
+		if (fifoQueue.release(value) != EPERM || OperationCountingType::checkCounters(1, 0, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 8 of test case.
+ *
+ * Tests batch operations of queues - as many elements as possible must be transferred (in proper order) and their
+ * number must be returned, operation must fail with EAGAIN when not even one element can be transferred and raw queues
+ * must reject sizes which are not a multiple of element size with EMSGSIZE.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase8()
+{
+	const uint32_t values[] {1, 2, 3, 4, 5, 6};
+	constexpr size_t valueSize {sizeof(*values)};
+	uint32_t buffer[6] {};
+	uint8_t priorities[4] {};
+
+	{
+		StaticRawFifoQueue<valueSize, 4> rawFifoQueue;
+		if (rawFifoQueue.tryPopBatch(buffer, sizeof(buffer)) != std::make_pair(EAGAIN, size_t{}))
+			return false;
+		if (rawFifoQueue.tryPushBatch(values, valueSize + 1) != std::make_pair(EMSGSIZE, size_t{}))
+			return false;
+		if (rawFifoQueue.tryPushBatch(values, sizeof(values)) != std::make_pair(0, size_t{4}))
+			return false;
+		if (rawFifoQueue.tryPushBatch(values, sizeof(values)) != std::make_pair(EAGAIN, size_t{}))
+			return false;
+		if (rawFifoQueue.tryPopBatch(buffer, 3 * valueSize) != std::make_pair(0, size_t{3}))
+			return false;
+		if (buffer[0] != 1 || buffer[1] != 2 || buffer[2] != 3)
+			return false;
+		if (rawFifoQueue.tryPopBatch(buffer, sizeof(buffer)) != std::make_pair(0, size_t{1}) || buffer[0] != 4)
+			return false;
+	}
+
+	{
+		StaticFifoQueue<uint32_t, 4> fifoQueue;
+		if (fifoQueue.tryPushBatch(values, 3) != std::make_pair(0, size_t{3}))
+			return false;
+		if (fifoQueue.tryPopBatch(buffer, 2) != std::make_pair(0, size_t{2}) || buffer[0] != 1 || buffer[1] != 2)
+			return false;
+		// storage wraps around in the middle of the batch
+		if (fifoQueue.tryPushBatch(values + 3, 3) != std::make_pair(0, size_t{3}))
+			return false;
+		if (fifoQueue.tryPopBatch(buffer, 6) != std::make_pair(0, size_t{4}))
+			return false;
+		if (buffer[0] != 3 || buffer[1] != 4 || buffer[2] != 5 || buffer[3] != 6)
+			return false;
+	}
+
+	{
+		StaticMessageQueue<uint32_t, 4> messageQueue;
+		if (messageQueue.tryPushBatch(1, values, 2) != std::make_pair(0, size_t{2}))
+			return false;
+		if (messageQueue.tryPushBatch(3, values + 2, 4) != std::make_pair(0, size_t{2}))
+			return false;
+		if (messageQueue.tryPushBatch(3, values, 1) != std::make_pair(EAGAIN, size_t{}))
+			return false;
+		if (messageQueue.tryPopBatch(priorities, buffer, 4) != std::make_pair(0, size_t{4}))
+			return false;
+		if (priorities[0] != 3 || priorities[1] != 3 || priorities[2] != 1 || priorities[3] != 1)
+			return false;
+		if (buffer[0] != 3 || buffer[1] != 4 || buffer[2] != 1 || buffer[3] != 2)
+			return false;
+	}
+
+	{
+		StaticRawMessageQueue<valueSize, 4> rawMessageQueue;
+		if (rawMessageQueue.tryPushBatch(2, values, 2 * valueSize) != std::make_pair(0, size_t{2}))
+			return false;
+		if (rawMessageQueue.tryPopBatch(nullptr, buffer, sizeof(buffer) - 1) != std::make_pair(EMSGSIZE, size_t{}))
+			return false;
+		if (rawMessageQueue.tryPopBatch(nullptr, buffer, sizeof(buffer)) != std::make_pair(0, size_t{2}))
+			return false;
+		if (buffer[0] != 1 || buffer[1] != 2)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 9 of test case.
+ *
+ * Tests message queues with priority buckets - elements must be popped in descending order of priority and in FIFO
+ * order within the same priority, also when priorities are spread over different words of the bitmap and when groups
+ * of elements are emptied and filled again.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase9()
+{
+	constexpr uint8_t pushedPriorities[] {100, 31, 255, 32, 100, 0, 255, 31};
+	// values are indexes of elements in pushedPriorities
+	constexpr uint32_t expectedValues[] {2, 6, 0, 4, 3, 1, 7, 5};
+	constexpr size_t queueSize {sizeof(pushedPriorities) / sizeof(*pushedPriorities)};
+
+	StaticMessageQueue<uint32_t, queueSize, true> staticMessageQueue;
+	DynamicMessageQueue<uint32_t, true> dynamicMessageQueue {queueSize};
+	MessageQueue<uint32_t>* const messageQueues[] {&staticMessageQueue, &dynamicMessageQueue};
+
+	for (const auto messageQueue : messageQueues)
+		for (size_t round {}; round < 2; ++round)
+		{
+			for (size_t i {}; i < queueSize; ++i)
+				if (messageQueue->tryPush(pushedPriorities[i], i) != 0)
+					return false;
+
+			for (const auto expectedValue : expectedValues)
+			{
+				uint8_t priority {};
+				uint32_t value {};
+				if (messageQueue->tryPop(priority, value) != 0)
+					return false;
+				if (priority != pushedPriorities[expectedValue] || value != expectedValue)
+					return false;
+			}
+
+			// pushing of element with lower priority than all others must not change the head of the queue
+			if (messageQueue->tryPush(5, 0) != 0 || messageQueue->tryPush(7, 1) != 0 ||
+					messageQueue->tryPush(5, 2) != 0)
+				return false;
+
+			uint8_t priority {};
+			uint32_t value {};
+			if (messageQueue->tryPop(priority, value) != 0 || priority != 7 || value != 1)
+				return false;
+			if (messageQueue->tryPush(7, 3) != 0)
+				return false;
+
+			for (const uint32_t expectedValue : {3, 0, 2})
+				if (messageQueue->tryPop(priority, value) != 0 || value != expectedValue)
+					return false;
+
+			if (messageQueue->tryPop(priority, value) != EAGAIN)
+				return false;
+		}
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -1188,7 +1412,7 @@ bool QueueOperationsTestCase::run_() const
 	const auto allocatedMemory = mallinfo().uordblks;
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6, phase7, phase8, phase9})
 	{
 		const auto ret = function();
 		if (ret != true)
@@ -2,7 +2,7 @@
  * \file
  * \brief QueueOperationsTestCase class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -27,7 +27,9 @@ namespace test
  * tryPushFor() and tryPushUntil()) and popping (pop(), tryPop(), tryPopFor() and tryPopUntil()) to/from
  * [Raw]{Fifo,Message}Queue, both from thread and from interrupt context - these operations must return expected result,
  * cause expected number of context switches, finish within expected time frame, execute expected actions on transferred
- * object (various constructor types, destructor, swap, ...) and leak no memory (in case of "dynamic" queue).
+ * object (various constructor types, destructor, swap, ...) and leak no memory (in case of "dynamic" queue). Zero-copy
+ * operations of [Raw]FifoQueue (reserve/commit and peek/release), batch operations of all queues and ordering of
+ * elements in MessageQueue with priority buckets are also tested.
  */
 
 class QueueOperationsTestCase : public TestCaseCommon
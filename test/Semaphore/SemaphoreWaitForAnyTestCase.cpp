@@ -0,0 +1,250 @@
+/**
+ * \file
+ * \brief SemaphoreWaitForAnyTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "SemaphoreWaitForAnyTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/waitForAny.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// return value of waitForAny() functions
+using WaitResult = std::pair<int, size_t>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in phase2(): main -> idle -> main
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/// priority of current test thread
+constexpr uint8_t testThreadPriority {SemaphoreWaitForAnyTestCase::getTestCasePriority()};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests waitForAny() and its variants with timeout in current thread only - they must succeed immediately when any
+ * semaphore has non-zero value (without changing this value) and time-out at expected time otherwise.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore semaphore0 {0};
+	Semaphore semaphore1 {1};
+	Semaphore* const semaphores[] {&semaphore0, &semaphore1};
+
+	if (waitForAny(semaphores) != WaitResult{0, 1} || semaphore0.getValue() != 0 || semaphore1.getValue() != 1)
+		return false;
+
+	if (semaphore1.tryWait() != 0)
+		return false;
+
+	{
+		// semaphores have zero value, so tryWaitForAnyFor() should time-out at expected time
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = tryWaitForAnyFor(singleDuration, semaphores);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+
+	{
+		// semaphores have zero value, so tryWaitForAnyUntil() should time-out at exact expected time
+		waitForNextTick();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = tryWaitForAnyUntil(requestedTimePoint, semaphores);
+		if (ret.first != ETIMEDOUT || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	{
+		// semaphore has non-zero value, so tryWaitForAnyFor() must succeed immediately
+		semaphore0.post();
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = tryWaitForAnyFor(singleDuration, semaphores);
+		if (ret != WaitResult{0, 0} || start != TickClock::now() || semaphore0.tryWait() != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt-thread signaling scenario. Main (current) thread waits for two semaphores. Software timer is used to
+ * post the second semaphore at specified time point from interrupt context, main thread is expected to be unblocked
+ * (with waitForAny(), tryWaitForAnyFor() and tryWaitForAnyUntil()) in the same moment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore0 {0};
+	Semaphore semaphore1 {0};
+	Semaphore* const semaphores[] {&semaphore0, &semaphore1};
+	auto softwareTimer = makeStaticSoftwareTimer(&Semaphore::post, std::ref(semaphore1));
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// semaphores have zero value, but wait should succeed at expected time
+		const auto ret = i == 0 ? waitForAny(semaphores) :
+				i == 1 ? tryWaitForAnyFor(wakeUpTimePoint - TickClock::now() + longDuration, semaphores) :
+				tryWaitForAnyUntil(wakeUpTimePoint + longDuration, semaphores);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != WaitResult{0, 1} || wakeUpTimePoint != wokenUpTimePoint || semaphore1.tryWait() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests waiting of several threads for the same objects - queue (via its semaphore) and semaphore. Two higher priority
+ * threads wait for any of them and then try to pop from the queue or lock the semaphore. Pushing of single element to
+ * the queue must unblock both threads, but only the first one may return - the second one must block again, as the
+ * queue was emptied. Posting of semaphore must then unblock the second thread.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticFifoQueue<uint8_t, 1> fifoQueue;
+	Semaphore semaphore {0};
+	Semaphore* const semaphores[] {&fifoQueue.getPopSemaphore(), &semaphore};
+	std::array<WaitResult, 2> results {};
+	std::array<int, 2> tryResults {};
+
+	const auto waitFunctor = [&fifoQueue, &semaphore, &semaphores](WaitResult& result, int& tryResult)
+			{
+				result = waitForAny(semaphores);
+				if (result.first != 0)
+					return;
+
+				uint8_t value {};
+				tryResult = result.second == 0 ? fifoQueue.tryPop(value) : semaphore.tryWait();
+			};
+
+	constexpr uint8_t threadPriority {testThreadPriority + 1};
+	std::array<DynamicThread, 2> threads
+	{{
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[0]),
+					std::ref(tryResults[0])),
+			makeDynamicThread({testThreadStackSize, threadPriority}, waitFunctor, std::ref(results[1]),
+					std::ref(tryResults[1])),
+	}};
+
+	bool ret {true};
+
+	for (auto& thread : threads)
+	{
+		thread.start();
+		ret &= thread.getState() == ThreadState::blockedOnSemaphore;
+	}
+
+	ret &= fifoQueue.tryPush(0x5a) == 0 && threads[0].getState() == ThreadState::terminated &&
+			threads[1].getState() == ThreadState::blockedOnSemaphore;
+
+	ret &= semaphore.post() == 0 && threads[1].getState() == ThreadState::terminated;
+
+	// make sure all threads are unblocked before they are joined, even if the test failed
+	semaphore.post();
+	semaphore.post();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	return ret == true && results[0] == WaitResult{0, 0} && results[1] == WaitResult{0, 1} && tryResults[0] == 0 &&
+			tryResults[1] == 0;
+}
+
+}	// namespace
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SemaphoreWaitForAnyTestCase::run_() const
+{
+#if DISTORTOS_WAIT_FOR_ANY_ENABLE == 1
+
+	return phase1() == true && phase2() == true && phase3() == true;
+
+#else	// DISTORTOS_WAIT_FOR_ANY_ENABLE != 1
+
+	return true;
+
+#endif	// DISTORTOS_WAIT_FOR_ANY_ENABLE != 1
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \brief SemaphoreWaitForAnyTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SEMAPHORE_SEMAPHOREWAITFORANYTESTCASE_HPP_
+#define TEST_SEMAPHORE_SEMAPHOREWAITFORANYTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests waitForAny() and its variants with timeout.
+ *
+ * Tests waiting for several semaphores at once, timeouts, posting of semaphore from interrupt context and waiting for
+ * several threads on the same semaphore and on queue. If waitForAny() is disabled in configuration, this test case
+ * does nothing and always succeeds.
+ */
+
+class SemaphoreWaitForAnyTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief SemaphoreWaitForAnyTestCase's constructor
+	 */
+
+	constexpr SemaphoreWaitForAnyTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SEMAPHORE_SEMAPHOREWAITFORANYTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief semaphoreTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 
 #include "SemaphorePriorityTestCase.hpp"
 #include "SemaphoreOperationsTestCase.hpp"
+#include "SemaphoreWaitForAnyTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -36,11 +37,15 @@ const SemaphorePriorityTestCase priorityTestCase;
 /// SemaphoreOperationsTestCase instance
 const SemaphoreOperationsTestCase operationsTestCase;
 
+/// SemaphoreWaitForAnyTestCase instance
+const SemaphoreWaitForAnyTestCase waitForAnyTestCase;
+
 /// array with references to TestCase objects related to semaphores
 const TestCaseGroup::Range::value_type semaphoreTestCases_[]
 {
 		TestCaseGroup::Range::value_type{priorityTestCase},
 		TestCaseGroup::Range::value_type{operationsTestCase},
+		TestCaseGroup::Range::value_type{waitForAnyTestCase},
 };
 
 }	// namespace
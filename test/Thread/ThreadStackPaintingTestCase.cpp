@@ -0,0 +1,151 @@
+/**
+ * \file
+ * \brief ThreadStackPaintingTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadStackPaintingTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
+
+#include "distortos/DynamicThread.hpp"
+
+#include <functional>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {1024};
+
+/// priority of test thread
+constexpr uint8_t testThreadPriority {1};
+
+/// size of buffer on stack of test thread, bytes
+constexpr size_t bufferSize {256};
+
+/// size of partially painted area, smaller than stack usage of test thread and not a multiple of stack sentinel's size
+constexpr size_t partialPaintSize {130};
+
+/// size of partially painted area rounded down to multiple of stack sentinel's size
+constexpr size_t partialPaintedSize {partialPaintSize / sizeof(uint32_t) * sizeof(uint32_t)};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread's function
+ *
+ * Fills a buffer on the stack, so that stack usage is greater than \a bufferSize, and checks "stack guard" (unless it
+ * is protected by MPU).
+ *
+ * \param [out] stackGuardIntact is a reference to variable which will be set to true if the buffer and "stack guard"
+ * of the thread are intact, false otherwise
+ */
+
+void threadFunction(bool& stackGuardIntact)
+{
+	volatile uint8_t buffer[bufferSize];
+	for (size_t i {}; i < bufferSize; ++i)
+		buffer[i] = i;
+
+	bool bufferIntact {true};
+	for (size_t i {}; i < bufferSize; ++i)
+		bufferIntact &= buffer[i] == static_cast<uint8_t>(i);
+
+#if DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE == 1
+
+	// "stack guard" of current thread is protected by MPU, so its contents cannot be read
+	stackGuardIntact = bufferIntact;
+
+#else	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
+
+	stackGuardIntact = bufferIntact == true &&
+			internal::getScheduler().getCurrentThreadControlBlock().getStack().checkStackGuard() == true;
+
+#endif	// DISTORTOS_CHECK_STACK_GUARD_MPU_ENABLE != 1
+}
+
+/**
+ * \brief Runs test thread with selected stack paint size.
+ *
+ * \param [in] paintSize is the size of area of the stack which is painted with stack sentinel
+ * \param [in] minHighWaterMark is the minimal expected stack "high water mark", bytes
+ * \param [in] saturated selects whether stack "high water mark" is expected to be equal to the size of painted area
+ * (true) or smaller (false)
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testPaintSize(const size_t paintSize, const size_t minHighWaterMark, const bool saturated)
+{
+	bool stackGuardIntact {};
+	auto testThread = makeDynamicThread({testThreadStackSize, testThreadPriority}, threadFunction,
+			std::ref(stackGuardIntact));
+	if (testThread.setStackPaintSize(paintSize) != 0)
+		return false;
+
+	if (testThread.start() != 0)
+		return false;
+
+	// stack paint size may be changed only before the thread is started
+	const auto ret = testThread.setStackPaintSize(paintSize) == EINVAL;
+	testThread.join();
+
+	const auto stackSize = testThread.getStackSize();
+	const auto paintedSize = testThread.getStackPaintedSize();
+	const auto expectedPaintedSize = paintSize < stackSize ? paintSize / sizeof(uint32_t) * sizeof(uint32_t) : stackSize;
+	const auto highWaterMark = testThread.getStackHighWaterMark();
+	return ret == true && stackGuardIntact == true && paintedSize == expectedPaintedSize &&
+			highWaterMark >= minHighWaterMark && highWaterMark <= paintedSize &&
+			(highWaterMark == paintedSize) == saturated;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadStackPaintingTestCase::run_() const
+{
+	// only "stack guard" is painted, so "high water mark" is always 0 and equal to the size of painted area
+	if (testPaintSize(0, 0, true) != true)
+		return false;
+
+	// stack usage is greater than painted area, so "high water mark" must saturate at the size of this area
+	if (testPaintSize(partialPaintSize, partialPaintedSize, true) != true)
+		return false;
+
+	// whole stack is painted, so "high water mark" must include the whole buffer and must not saturate
+	return testPaintSize(SIZE_MAX, bufferSize, false);
+}
+
+}	// namespace test
+
+}	// namespace distortos
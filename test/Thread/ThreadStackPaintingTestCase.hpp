@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief ThreadStackPaintingTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSTACKPAINTINGTESTCASE_HPP_
+#define TEST_THREAD_THREADSTACKPAINTINGTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests partial painting of thread's stack.
+ *
+ * Starts threads with stack paint size of 0 (just "stack guard"), with size which is smaller than stack usage of the
+ * thread and which is not a multiple of stack sentinel's size, and with SIZE_MAX (whole stack). Each thread checks
+ * whether its "stack guard" is intact (unless it is protected by MPU). Size of painted area reported by the thread
+ * must match the requested paint size. Stack "high water mark" must saturate at the size of painted area only when
+ * the stack was painted partially - saturation is detected by comparing both values.
+ */
+
+class ThreadStackPaintingTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadStackPaintingTestCase's constructor
+	 */
+
+	constexpr ThreadStackPaintingTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSTACKPAINTINGTESTCASE_HPP_
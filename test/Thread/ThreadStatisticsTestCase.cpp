@@ -0,0 +1,206 @@
+/**
+ * \file
+ * \brief ThreadStatisticsTestCase class implementation
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadStatisticsTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of threads which can be reported in the test
+constexpr size_t maxThreads {16};
+
+/// priority of test thread
+constexpr uint8_t testThreadPriority {ThreadStatisticsTestCase::getTestCasePriority() + 1};
+
+/// priority ceiling of mutex locked by test thread, which is the effective priority of this thread
+constexpr uint8_t priorityCeiling {testThreadPriority + 1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// value of stackSize used to check whether element of buffer was not modified
+constexpr size_t unmodifiedMarker {SIZE_MAX};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for statistics of threads
+using Buffer = std::array<statistics::ThreadStatistics, maxThreads>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks stack "high water marks" of reported threads.
+ *
+ * \param [in] buffer is a reference to buffer with statistics of threads
+ * \param [in] threads is the number of reported threads
+ *
+ * \return true if stack "high water mark" of each reported thread is non-zero and not greater than size of its stack,
+ * false otherwise
+ */
+
+bool checkStackHighWaterMarks(const Buffer& buffer, const size_t threads)
+{
+	for (size_t i {}; i < threads; ++i)
+		if (buffer[i].stackHighWaterMark == 0 || buffer[i].stackHighWaterMark > buffer[i].stackSize)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Finds statistics of the thread.
+ *
+ * \param [in] buffer is a reference to buffer with statistics of threads
+ * \param [in] threads is the number of reported threads
+ * \param [in] thread is a reference to searched thread
+ *
+ * \return pointer to statistics of \a thread, nullptr if \a thread was not reported
+ */
+
+const statistics::ThreadStatistics* findThread(const Buffer& buffer, const size_t threads, const Thread& thread)
+{
+	for (size_t i {}; i < threads; ++i)
+		if (buffer[i].identifier.getThread() == &thread)
+			return &buffer[i];
+
+	return {};
+}
+
+/**
+ * \brief Checks statistics of threads while test thread is blocked.
+ *
+ * \param [in] thread is a reference to test thread, which holds the mutex and is blocked on the semaphore
+ * \param [in] threads is the number of threads of the current thread group (including test thread)
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool checkBlockedThread(const Thread& thread, const size_t threads)
+{
+	if (threads > maxThreads || statistics::getThreadStatistics(nullptr, 0) != threads)
+		return false;
+
+	{
+		Buffer buffer;
+		if (statistics::getThreadStatistics(buffer.data(), buffer.size()) != threads ||
+				checkStackHighWaterMarks(buffer, threads) == false)
+			return false;
+
+		const auto threadStatistics = findThread(buffer, threads, thread);
+		if (threadStatistics == nullptr || threadStatistics->priority != testThreadPriority ||
+				threadStatistics->effectivePriority != priorityCeiling ||
+				threadStatistics->state != ThreadState::blockedOnSemaphore ||
+				threadStatistics->stackSize != thread.getStackSize())
+			return false;
+	}
+
+	{
+		// buffer is too small - number of threads must be returned, but only the first elements may be filled
+		Buffer buffer;
+		for (auto& threadStatistics : buffer)
+			threadStatistics.stackSize = unmodifiedMarker;
+		const auto size = threads - 1;
+		if (statistics::getThreadStatistics(buffer.data(), size) != threads ||
+				checkStackHighWaterMarks(buffer, size) == false || buffer[size].stackSize != unmodifiedMarker)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadStatisticsTestCase::run_() const
+{
+#if DISTORTOS_THREAD_STATISTICS_ENABLE == 1
+
+	const auto initialThreads = statistics::getThreadStatistics(nullptr, 0);
+	if (initialThreads == 0)
+		return false;
+
+	bool ret {true};
+
+	{
+		Mutex mutex {Mutex::Protocol::priorityProtect, priorityCeiling};
+		Semaphore semaphore {0};
+		auto thread = makeDynamicThread({testThreadStackSize, testThreadPriority},
+				[&mutex, &semaphore]()
+				{
+					mutex.lock();
+					semaphore.wait();
+					mutex.unlock();
+				});
+
+		// thread which was not started yet is not reported
+		ret &= statistics::getThreadStatistics(nullptr, 0) == initialThreads;
+
+		thread.start();
+		ret &= thread.getState() == ThreadState::blockedOnSemaphore;
+		ret &= checkBlockedThread(thread, initialThreads + 1);
+
+		semaphore.post();
+		thread.join();
+
+		// terminated thread is reported until it is destroyed
+		Buffer buffer;
+		const auto threads = statistics::getThreadStatistics(buffer.data(), buffer.size());
+		const auto threadStatistics = findThread(buffer, threads, thread);
+		ret &= threads == initialThreads + 1 && threadStatistics != nullptr &&
+				threadStatistics->state == ThreadState::terminated;
+	}
+
+	return ret == true && statistics::getThreadStatistics(nullptr, 0) == initialThreads;
+
+#else	// DISTORTOS_THREAD_STATISTICS_ENABLE != 1
+
+	return true;
+
+#endif	// DISTORTOS_THREAD_STATISTICS_ENABLE != 1
+}
+
+}	// namespace test
+
+}	// namespace distortos
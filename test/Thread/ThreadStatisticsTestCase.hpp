@@ -0,0 +1,76 @@
+/**
+ * \file
+ * \brief ThreadStatisticsTestCase class header
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSTATISTICSTESTCASE_HPP_
+#define TEST_THREAD_THREADSTATISTICSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests statistics of threads.
+ *
+ * Starts a higher priority thread which locks a mutex with priorityProtect protocol and blocks on a semaphore. Checks
+ * whether statistics::getThreadStatistics() reports the number of threads of the current thread group (also when the
+ * buffer is too small or empty), whether priority, effective priority, state and size of stack of this thread are
+ * reported correctly and whether stack "high water mark" of each reported thread is non-zero and not greater than size
+ * of its stack.
+ *
+ * This test case does nothing if distortos_Scheduler_28_Thread_statistics is not enabled.
+ */
+
+class ThreadStatisticsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 2};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief ThreadStatisticsTestCase's constructor
+	 */
+
+	constexpr ThreadStatisticsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSTATISTICSTESTCASE_HPP_
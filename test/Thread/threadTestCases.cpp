@@ -2,7 +2,7 @@
  * \file
  * \brief threadTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -18,6 +18,8 @@
 #include "ThreadSleepUntilTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadStatisticsTestCase.hpp"
+#include "ThreadStackPaintingTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -55,6 +57,12 @@ const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+/// ThreadStatisticsTestCase instance
+const ThreadStatisticsTestCase statisticsTestCase;
+
+/// ThreadStackPaintingTestCase instance
+const ThreadStackPaintingTestCase stackPaintingTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -65,6 +73,8 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+		TestCaseGroup::Range::value_type{statisticsTestCase},
+		TestCaseGroup::Range::value_type{stackPaintingTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,123 @@
+/**
+ * \file
+ * \brief MutexFastPathTestCase class implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-MutexFastPathTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/Mutex.hpp"
+
+#include <algorithm>
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of measurements for each mutex, the shortest one is used
+constexpr size_t measurements {16};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the shortest duration of uncontended lock() + unlock() of the mutex.
+ *
+ * \param [in] mutex is a reference to measured mutex, it must be unlocked
+ *
+ * \return shortest duration of lock() + unlock(), core cycles, 0 if any operation failed
+ */
+
+uint32_t measureLockUnlock(Mutex& mutex)
+{
+	uint32_t shortest {UINT32_MAX};
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto start = DWT->CYCCNT;
+		const auto lockRet = mutex.lock();
+		const auto unlockRet = mutex.unlock();
+		const uint32_t duration = DWT->CYCCNT - start;
+		if (lockRet != 0 || unlockRet != 0)
+			return {};
+
+		shortest = std::min(shortest, duration);
+	}
+
+	return shortest;
+}
+
+}	// namespace
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::array<std::array<uint32_t, 3>, 3> mutexFastPathCycles;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MutexFastPathTestCase::run_() const
+{
+#if DISTORTOS_MUTEX_FAST_PATH_ENABLE == 1
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	const Mutex::Type types[] {Mutex::Type::normal, Mutex::Type::errorChecking, Mutex::Type::recursive};
+	for (size_t i {}; i < mutexFastPathCycles.size(); ++i)
+	{
+		Mutex mutex {types[i]};
+		Mutex priorityInheritanceMutex {types[i], Mutex::Protocol::priorityInheritance};
+		Mutex priorityProtectMutex {types[i], Mutex::Protocol::priorityProtect, UINT8_MAX};
+		auto& cycles = mutexFastPathCycles[i];
+		cycles = {{measureLockUnlock(mutex), measureLockUnlock(priorityInheritanceMutex),
+				measureLockUnlock(priorityProtectMutex)}};
+
+		if (std::find(cycles.begin(), cycles.end(), 0) != cycles.end())
+			return false;
+		// regular way with interrupt masking enabled (always used by priorityProtect mutex) must be slower
+		if (cycles[0] >= cycles[2] || cycles[1] >= cycles[2])
+			return false;
+	}
+
+	return true;
+
+#else	// DISTORTOS_MUTEX_FAST_PATH_ENABLE != 1
+
+	return true;
+
+#endif	// DISTORTOS_MUTEX_FAST_PATH_ENABLE != 1
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief MutexFastPathTestCase class header for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MUTEXFASTPATHTESTCASE_HPP_
+#define TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MUTEXFASTPATHTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Measures lock-free fast path of mutex locking and unlocking.
+ *
+ * For each mutex type measures (with core cycle counter) the shortest duration of uncontended lock() + unlock() of
+ * mutexes with Protocol::none and Protocol::priorityInheritance - which use the fast path - and of mutex with
+ * Protocol::priorityProtect - which always uses the regular way with interrupt masking enabled. Durations with the fast
+ * path must be shorter. Measured durations are stored in mutexFastPathCycles.
+ *
+ * This test case does nothing if distortos_Scheduler_24_Mutex_fast_path is not enabled.
+ */
+
+class MutexFastPathTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief MutexFastPathTestCase's constructor
+	 */
+
+	constexpr MutexFastPathTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+/**
+ * \brief Shortest durations of lock() + unlock() measured by the last run of MutexFastPathTestCase, core cycles.
+ *
+ * First index selects mutex type (normal, errorChecking, recursive), second index selects mutex protocol (none,
+ * priorityInheritance, priorityProtect). These values may be inspected with debugger after the test.
+ */
+
+extern std::array<std::array<uint32_t, 3>, 3> mutexFastPathCycles;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MUTEXFASTPATHTESTCASE_HPP_
@@ -0,0 +1,207 @@
+/**
+ * \file
+ * \brief SemaphoreFastPathTestCase class implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-SemaphoreFastPathTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include <cerrno>
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+namespace distortos
+{
+
+namespace test
+{
+
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of measurements, the shortest one is used
+constexpr size_t measurements {16};
+
+/// max value of semaphores used in test
+constexpr Semaphore::Value maxValue {2};
+
+/// priority of test thread, higher than priority of test case
+constexpr uint8_t testThreadPriority {SemaphoreFastPathTestCase::getTestCasePriority() + 1};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the shortest duration of uncontended post() + wait().
+ *
+ * \return shortest duration of post() + wait(), core cycles, 0 if any operation failed
+ */
+
+uint32_t measureFastPath()
+{
+	Semaphore semaphore {0, maxValue};
+	uint32_t shortest {UINT32_MAX};
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto start = DWT->CYCCNT;
+		const auto postRet = semaphore.post();
+		const auto waitRet = semaphore.wait();
+		const uint32_t duration = DWT->CYCCNT - start;
+		if (postRet != 0 || waitRet != 0 || semaphore.getValue() != 0)
+			return {};
+
+		shortest = std::min(shortest, duration);
+	}
+
+	return shortest;
+}
+
+/**
+ * \brief Measures the shortest duration of post() of semaphore at its max value + tryWait() of semaphore with value 0.
+ *
+ * Both operations fail on the fast path, so they fall back to the regular way with interrupt masking enabled.
+ *
+ * \return shortest duration of post() + tryWait(), core cycles, 0 if any operation returned unexpected value
+ */
+
+uint32_t measureRegularPath()
+{
+	Semaphore fullSemaphore {maxValue, maxValue};
+	Semaphore emptySemaphore {0, maxValue};
+	uint32_t shortest {UINT32_MAX};
+	for (size_t i {}; i < measurements; ++i)
+	{
+		const auto start = DWT->CYCCNT;
+		const auto postRet = fullSemaphore.post();
+		const auto tryWaitRet = emptySemaphore.tryWait();
+		const uint32_t duration = DWT->CYCCNT - start;
+		if (postRet != EOVERFLOW || tryWaitRet != EAGAIN || fullSemaphore.getValue() != maxValue ||
+				emptySemaphore.getValue() != 0)
+			return {};
+
+		shortest = std::min(shortest, duration);
+	}
+
+	return shortest;
+}
+
+/**
+ * \brief Tests fallback of post() to the regular way when a thread is blocked on the semaphore.
+ *
+ * Higher priority thread blocks on semaphore with value 0. post() must unblock this thread and leave the value of
+ * semaphore unchanged.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testBlockedThread()
+{
+	Semaphore semaphore {0, maxValue};
+	int waitRet {-1};
+	auto thread = makeDynamicThread({testThreadStackSize, testThreadPriority},
+			[&semaphore, &waitRet]()
+			{
+				waitRet = semaphore.wait();
+			});
+
+	thread.start();
+	bool ret {thread.getState() == ThreadState::blockedOnSemaphore};
+	ret &= semaphore.post() == 0 && thread.getState() == ThreadState::terminated && semaphore.getValue() == 0;
+
+	// make sure the thread is unblocked before it is joined, even if the test failed
+	if (thread.getState() != ThreadState::terminated)
+		semaphore.post();
+
+	thread.join();
+	return ret == true && waitRet == 0;
+}
+
+/**
+ * \brief Tests post() of semaphores which reach their max value.
+ *
+ * Semaphore with default max value (max for Semaphore::Value) is also tested, as the value must not wrap around.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testMaxValue()
+{
+	Semaphore semaphore {maxValue - 1, maxValue};
+	if (semaphore.post() != 0 || semaphore.getValue() != maxValue || semaphore.post() != EOVERFLOW ||
+			semaphore.getValue() != maxValue || semaphore.tryWait() != 0 || semaphore.getValue() != maxValue - 1)
+		return false;
+
+	constexpr auto defaultMaxValue = std::numeric_limits<Semaphore::Value>::max();
+	Semaphore defaultSemaphore {defaultMaxValue - 1};
+	return defaultSemaphore.post() == 0 && defaultSemaphore.getValue() == defaultMaxValue &&
+			defaultSemaphore.post() == EOVERFLOW && defaultSemaphore.getValue() == defaultMaxValue;
+}
+
+}	// namespace
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::array<uint32_t, 2> semaphoreFastPathCycles;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SemaphoreFastPathTestCase::run_() const
+{
+#if DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE == 1
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	semaphoreFastPathCycles = {{measureFastPath(), measureRegularPath()}};
+	if (std::find(semaphoreFastPathCycles.begin(), semaphoreFastPathCycles.end(), 0) !=
+			semaphoreFastPathCycles.end())
+		return false;
+	// regular way with interrupt masking enabled must be slower
+	if (semaphoreFastPathCycles[0] >= semaphoreFastPathCycles[1])
+		return false;
+
+	return testBlockedThread() == true && testMaxValue() == true;
+
+#else	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE != 1
+
+	return true;
+
+#endif	// DISTORTOS_SEMAPHORE_FAST_PATH_ENABLE != 1
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief SemaphoreFastPathTestCase class header for ARMv7-M
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_SEMAPHOREFASTPATHTESTCASE_HPP_
+#define TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_SEMAPHOREFASTPATHTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests lock-free fast path of semaphore posting and locking.
+ *
+ * Measures (with core cycle counter) the shortest duration of uncontended post() + wait() - which use the fast path -
+ * and the shortest duration of post() of semaphore at its max value + tryWait() of semaphore with value 0 - which fall
+ * back to the regular way with interrupt masking enabled. Durations with the fast path must be shorter. Measured
+ * durations are stored in semaphoreFastPathCycles.
+ *
+ * Tests also that post() falls back to the regular way when a thread is blocked on the semaphore - the value must not
+ * be incremented, but the thread must be unblocked - and that post() of semaphore at its max value fails with
+ * EOVERFLOW without changing the value.
+ *
+ * This test case does nothing if distortos_Scheduler_25_Semaphore_fast_path is not enabled.
+ */
+
+class SemaphoreFastPathTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \return priority at which this test case should be executed
+	 */
+
+	constexpr static uint8_t getTestCasePriority()
+	{
+		return testCasePriority_;
+	}
+
+	/**
+	 * \brief SemaphoreFastPathTestCase's constructor
+	 */
+
+	constexpr SemaphoreFastPathTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+/**
+ * \brief Shortest durations measured by the last run of SemaphoreFastPathTestCase, core cycles.
+ *
+ * First element is the duration of uncontended post() + wait() (fast path), second element is the duration of
+ * overflowing post() + failing tryWait() (regular way). These values may be inspected with debugger after the test.
+ */
+
+extern std::array<uint32_t, 2> semaphoreFastPathCycles;
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_SEMAPHOREFASTPATHTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief architectureTestCases object definition for ARMv7-M
  *
- * \author Copyright (C) 2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2015-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,8 @@
 
 #include "ARMv7-M-FpuThreadTestCase.hpp"
 #include "ARMv7-M-FpuSignalTestCase.hpp"
+#include "ARMv7-M-MutexFastPathTestCase.hpp"
+#include "ARMv7-M-SemaphoreFastPathTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -35,11 +37,19 @@ const FpuThreadTestCase fpuThreadTestCase;
 /// FpuSignalTestCase instance
 const FpuSignalTestCase fpuSignalTestCase;
 
+/// MutexFastPathTestCase instance
+const MutexFastPathTestCase mutexFastPathTestCase;
+
+/// SemaphoreFastPathTestCase instance
+const SemaphoreFastPathTestCase semaphoreFastPathTestCase;
+
 /// array with references to architecture-specific test cases
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
 		TestCaseGroup::Range::value_type{fpuThreadTestCase},
 		TestCaseGroup::Range::value_type{fpuSignalTestCase},
+		TestCaseGroup::Range::value_type{mutexFastPathTestCase},
+		TestCaseGroup::Range::value_type{semaphoreFastPathTestCase},
 };
 
 }	// namespace
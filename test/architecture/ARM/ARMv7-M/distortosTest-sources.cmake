@@ -1,7 +1,7 @@
 #
 # file: distortosTest-sources.cmake
 #
-# author: Copyright (C) 2018-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+# author: Copyright (C) 2018-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
 #
 # This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
 # distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
@@ -14,6 +14,8 @@ if(DISTORTOS_ARCHITECTURE_ARMV7_M)
 			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-checkFpuRegisters.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-FpuSignalTestCase.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-FpuThreadTestCase.cpp
+			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-MutexFastPathTestCase.cpp
+			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-SemaphoreFastPathTestCase.cpp
 			${CMAKE_CURRENT_LIST_DIR}/ARMv7-M-setFpuRegisters.cpp)
 
 endif()
@@ -2,7 +2,7 @@
  * \file
  * \brief testCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2014-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,6 +16,8 @@
 #include "Semaphore/semaphoreTestCases.hpp"
 #include "Mutex/mutexTestCases.hpp"
 #include "ConditionVariable/conditionVariableTestCases.hpp"
+#include "EventFlags/eventFlagsTestCases.hpp"
+#include "MemoryPool/memoryPoolTestCases.hpp"
 #include "Queue/queueTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
 #include "CallOnce/callOnceTestCases.hpp"
@@ -44,6 +46,8 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{semaphoreTestCases},
 		TestCaseGroup::Range::value_type{mutexTestCases},
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
+		TestCaseGroup::Range::value_type{eventFlagsTestCases},
+		TestCaseGroup::Range::value_type{memoryPoolTestCases},
 		TestCaseGroup::Range::value_type{queueTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
 		TestCaseGroup::Range::value_type{callOnceTestCases},
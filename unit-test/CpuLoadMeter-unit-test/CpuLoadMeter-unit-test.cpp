@@ -0,0 +1,114 @@
+/**
+ * \file
+ * \brief CpuLoadMeter test cases
+ *
+ * This test checks whether CpuLoadMeter properly divides ticks into periods, also when many ticks are added at once,
+ * and whether it properly computes CPU load over requested number of most recent periods.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/CpuLoadMeter.hpp"
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// tested CPU load meter - 4 periods, each 10 ticks long
+using TestCpuLoadMeter = distortos::internal::CpuLoadMeter<4, 10>;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initial state", "[initial]")
+{
+	const TestCpuLoadMeter cpuLoadMeter;
+	REQUIRE(cpuLoadMeter.getIdleTicks() == 0);
+	REQUIRE(cpuLoadMeter.getTicks() == 0);
+	for (size_t periods {}; periods <= TestCpuLoadMeter::periods + 1; ++periods)
+		REQUIRE(cpuLoadMeter.getLoad(periods) == 0);
+}
+
+TEST_CASE("Testing single ticks", "[single]")
+{
+	TestCpuLoadMeter cpuLoadMeter;
+
+	// incomplete period is not taken into account
+	for (size_t i {}; i < TestCpuLoadMeter::periodLength - 1; ++i)
+		cpuLoadMeter.add(1, false);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 0);
+
+	// first period - 3 idle ticks out of 10
+	cpuLoadMeter.add(1, true);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 900);
+	cpuLoadMeter.add(1, true);
+	cpuLoadMeter.add(1, true);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 900);
+
+	// second period - 2 + 8 idle ticks out of 10
+	for (size_t i {}; i < TestCpuLoadMeter::periodLength - 2; ++i)
+		cpuLoadMeter.add(1, true);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 0);
+	REQUIRE(cpuLoadMeter.getLoad(2) == 450);
+	REQUIRE(cpuLoadMeter.getLoad(TestCpuLoadMeter::periods) == 450);
+	REQUIRE(cpuLoadMeter.getLoad(0) == 0);
+
+	REQUIRE(cpuLoadMeter.getIdleTicks() == 11);
+	REQUIRE(cpuLoadMeter.getTicks() == 20);
+}
+
+TEST_CASE("Testing multiple ticks", "[multiple]")
+{
+	TestCpuLoadMeter cpuLoadMeter;
+
+	// 25 busy ticks - two complete periods, 5 ticks in third period
+	cpuLoadMeter.add(25, false);
+	REQUIRE(cpuLoadMeter.getLoad(TestCpuLoadMeter::periods) == 1000);
+
+	// 18 idle ticks - third period completed with 5 idle ticks, fourth period is idle, 3 idle ticks in fifth period
+	cpuLoadMeter.add(18, true);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 0);
+	REQUIRE(cpuLoadMeter.getLoad(2) == 250);
+	REQUIRE(cpuLoadMeter.getLoad(3) == 500);
+	REQUIRE(cpuLoadMeter.getLoad(4) == 625);
+
+	// fifth period completed with 3 idle ticks, the oldest period is overwritten
+	cpuLoadMeter.add(7, false);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 700);
+	REQUIRE(cpuLoadMeter.getLoad(4) == 550);
+	REQUIRE(cpuLoadMeter.getLoad(5) == 550);
+
+	REQUIRE(cpuLoadMeter.getIdleTicks() == 18);
+	REQUIRE(cpuLoadMeter.getTicks() == 50);
+}
+
+TEST_CASE("Testing ticks longer than whole history", "[long]")
+{
+	TestCpuLoadMeter cpuLoadMeter;
+
+	cpuLoadMeter.add(3, false);
+	cpuLoadMeter.add(UINT64_C(1000000007), true);
+	REQUIRE(cpuLoadMeter.getLoad(TestCpuLoadMeter::periods) == 0);
+	REQUIRE(cpuLoadMeter.getIdleTicks() == UINT64_C(1000000007));
+	REQUIRE(cpuLoadMeter.getTicks() == UINT64_C(1000000010));
+
+	// whole history is idle and current period is empty
+	cpuLoadMeter.add(1, false);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 0);
+	REQUIRE(cpuLoadMeter.getLoad(TestCpuLoadMeter::periods) == 0);
+	cpuLoadMeter.add(9, false);
+	REQUIRE(cpuLoadMeter.getLoad(1) == 1000);
+	REQUIRE(cpuLoadMeter.getLoad(2) == 500);
+}
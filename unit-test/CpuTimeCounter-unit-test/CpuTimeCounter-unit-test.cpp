@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief CpuTimeCounter test cases
+ *
+ * This test checks whether CpuTimeCounter properly measures periods between samples of core cycle counter, also when
+ * the counter overflows, and whether it properly extends core cycle counter to 64 bits.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/CpuTimeCounter.hpp"
+
+using distortos::architecture::GetCycleCountMock;
+using distortos::internal::CpuTimeCounter;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initial state", "[initial]")
+{
+	GetCycleCountMock getCycleCountMock;
+	trompeloeil::sequence sequence {};
+
+	CpuTimeCounter cpuTimeCounter;
+
+	constexpr uint32_t cycleCount {0x2c4e5a07};
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount);
+	REQUIRE(cpuTimeCounter.getElapsed() == cycleCount);
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount);
+	REQUIRE(cpuTimeCounter.getCycleCount() == cycleCount);
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount);
+	REQUIRE(cpuTimeCounter.sample() == cycleCount);
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount);
+	REQUIRE(cpuTimeCounter.getElapsed() == 0);
+}
+
+TEST_CASE("Testing sample()", "[sample]")
+{
+	GetCycleCountMock getCycleCountMock;
+	trompeloeil::sequence sequence {};
+
+	CpuTimeCounter cpuTimeCounter;
+
+	SECTION("Periods between samples should be measured properly")
+	{
+		const std::pair<uint32_t, uint32_t> samples[]
+		{
+				{0x00001000, 0x00001000},
+				{0x00001000, 0x00000000},
+				{0x7ffff000, 0x7fffe000},
+				{0xfffffff0, 0x80000ff0},
+				{0xffffffff, 0x0000000f},
+				{0x00000010, 0x00000011},
+		};
+
+		for (auto& sample : samples)
+		{
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(sample.first);
+			REQUIRE(cpuTimeCounter.sample() == sample.second);
+		}
+
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(0x00000020);
+		REQUIRE(cpuTimeCounter.getCycleCount() == 0x100000020);
+	}
+	SECTION("Overflows of core cycle counter should be handled properly")
+	{
+		uint32_t cycleCount {};
+		uint64_t expectedCycleCount {};
+		constexpr uint32_t period {0xc0000001};
+		for (size_t i {}; i < 16; ++i)
+		{
+			cycleCount += period;
+			expectedCycleCount += period;
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount);
+			REQUIRE(cpuTimeCounter.sample() == period);
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount + 0x100);
+			REQUIRE(cpuTimeCounter.getElapsed() == 0x100);
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(cycleCount + 0x100);
+			REQUIRE(cpuTimeCounter.getCycleCount() == expectedCycleCount + 0x100);
+		}
+		REQUIRE(expectedCycleCount > UINT32_MAX);
+	}
+}
@@ -0,0 +1,262 @@
+/**
+ * \file
+ * \brief DeadlineThreadList test cases
+ *
+ * This test checks whether ThreadList and PriorityBitmapThreadList order threads with the same effective priority by
+ * deadline when SchedulingPolicy::deadline is enabled, and whether both containers keep exactly the same order of
+ * elements for all operations used by the scheduler.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/PriorityBitmapThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <deque>
+#include <random>
+
+using distortos::internal::PriorityBitmapThreadList;
+using distortos::internal::ThreadControlBlock;
+using distortos::internal::ThreadList;
+using distortos::TickClock;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// deadline of threads which don't use SchedulingPolicy::deadline
+constexpr auto noDeadline = TickClock::time_point::max();
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// set of threads linked either in the tested list or in the "blocked" list
+struct ThreadSet
+{
+	/// threads
+	std::deque<ThreadControlBlock> threads;
+
+	/// "blocked" list
+	ThreadList blockedList;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Adds thread to set of threads.
+ *
+ * \param [in] threadSet is a reference to set of threads
+ * \param [in] priority is the priority of thread
+ * \param [in] deadline is the deadline of thread
+ *
+ * \return reference to added thread
+ */
+
+ThreadControlBlock& addThread(ThreadSet& threadSet, const uint8_t priority, const TickClock::time_point deadline)
+{
+	threadSet.threads.emplace_back(priority);
+	threadSet.threads.back().setDeadline(deadline);
+	return threadSet.threads.back();
+}
+
+/**
+ * \brief Gets indexes of threads linked in the list.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadSet is a reference to set of threads
+ *
+ * \return vector with indexes (in \a threadSet) of threads linked in \a list
+ */
+
+template<typename List>
+std::vector<size_t> getIndexes(const List& list, const ThreadSet& threadSet)
+{
+	std::vector<size_t> indexes;
+	for (auto& thread : list)
+		for (size_t i {}; i < threadSet.threads.size(); ++i)
+			if (&threadSet.threads[i] == &thread)
+				indexes.emplace_back(i);
+	return indexes;
+}
+
+/**
+ * \brief Repositions the thread in sorted ThreadList - the same way as ThreadControlBlock::reposition() does.
+ *
+ * \param [in] list is a reference to list
+ * \param [in] thread is a reference to repositioned thread
+ * \param [in] loweringBefore selects the method of ordering when lowering the priority
+ */
+
+void reposition(ThreadList& list, ThreadControlBlock& thread, const bool loweringBefore)
+{
+	const auto deadline = thread.getDeadline();
+	if (loweringBefore == true)
+		thread.setDeadline(deadline - TickClock::duration{1});
+	list.splice(ThreadList::iterator{thread});
+	thread.setDeadline(deadline);
+}
+
+/**
+ * \brief Repositions the thread in PriorityBitmapThreadList.
+ *
+ * \param [in] list is a reference to list
+ * \param [in] thread is a reference to repositioned thread
+ * \param [in] loweringBefore selects the method of ordering when lowering the priority
+ */
+
+void reposition(PriorityBitmapThreadList& list, ThreadControlBlock& thread, const bool loweringBefore)
+{
+	list.reposition(ThreadList::iterator{thread}, loweringBefore);
+}
+
+/**
+ * \brief Runs the same pseudo-random sequence of operations on tested list and checks its contents after each step.
+ *
+ * Priorities and deadlines are selected from narrow ranges, so that there are many threads with equal priorities and
+ * deadlines.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] seed is the seed for pseudo-random number generator
+ * \param [in] threadSet is a reference to set of threads
+ *
+ * \return vector with indexes of threads linked in tested list after each step
+ */
+
+template<typename List>
+std::vector<std::vector<size_t>> runSequence(const unsigned int seed, ThreadSet& threadSet)
+{
+	std::vector<std::vector<size_t>> results;
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<int> priorityDistribution {0, 3};
+	std::uniform_int_distribution<int> deadlineDistribution {0, 10};
+	std::uniform_int_distribution<int> operationDistribution {0, 7};
+	List list;
+	std::vector<ThreadControlBlock*> runnable;
+
+	const auto getDeadline = [&generator, &deadlineDistribution]()
+			{
+				const auto value = deadlineDistribution(generator);
+				return value == 0 ? noDeadline : TickClock::time_point{TickClock::duration{value}};
+			};
+
+	for (size_t step {}; step < 2000; ++step)
+	{
+		runnable.clear();
+		for (auto& thread : list)
+			runnable.emplace_back(&thread);
+		std::uniform_int_distribution<size_t> runnableDistribution {0, runnable.empty() == false ?
+				runnable.size() - 1 : 0};
+		const auto operation = runnable.empty() == true ? 0 : operationDistribution(generator);
+		if (operation == 0 && threadSet.threads.size() < 100)	// add new thread
+			list.insert(addThread(threadSet, priorityDistribution(generator), getDeadline()));
+		else if (operation == 1)	// block thread
+		{
+			auto& thread = *runnable[runnableDistribution(generator)];
+			list.erase(ThreadList::iterator{thread});
+			threadSet.blockedList.insert(thread);
+		}
+		else if (operation == 2 && threadSet.blockedList.empty() == false)	// unblock thread
+			list.splice(threadSet.blockedList.begin());
+		else if (operation == 3)	// round-robin rotation
+			list.splice(ThreadList::iterator{*runnable[runnableDistribution(generator)]});
+		else if (operation == 4 || operation == 5)	// change of priority
+		{
+			auto& thread = *runnable[runnableDistribution(generator)];
+			const auto oldPriority = thread.getPriority();
+			thread.setPriority(priorityDistribution(generator));
+			if (thread.getPriority() != oldPriority)
+				reposition(list, thread, operation == 5 && thread.getPriority() < oldPriority);
+		}
+		else if (operation >= 6)	// change of deadline
+		{
+			auto& thread = *runnable[runnableDistribution(generator)];
+			thread.setDeadline(getDeadline());
+			reposition(list, thread, false);
+		}
+
+		results.emplace_back(getIndexes(list, threadSet));
+	}
+
+	return results;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEMPLATE_TEST_CASE("Testing ordering by deadline", "[ordering]", ThreadList, PriorityBitmapThreadList)
+{
+	ThreadSet threadSet;
+	addThread(threadSet, 10, noDeadline);
+	addThread(threadSet, 10, TickClock::time_point{TickClock::duration{300}});
+	addThread(threadSet, 20, TickClock::time_point{TickClock::duration{500}});
+	addThread(threadSet, 10, TickClock::time_point{TickClock::duration{100}});
+	addThread(threadSet, 10, noDeadline);
+	addThread(threadSet, 10, TickClock::time_point{TickClock::duration{300}});
+
+	TestType list;
+	for (auto& thread : threadSet.threads)
+		list.insert(thread);
+
+	// fixed priorities are respected, threads with earlier deadlines are placed before threads with later deadlines
+	// and before threads without deadlines, threads with equal deadlines are kept in FIFO order
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 3, 1, 5, 0, 4});
+
+	// round-robin rotation doesn't move thread behind threads with later deadlines
+	list.splice(ThreadList::iterator{threadSet.threads[3]});
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 3, 1, 5, 0, 4});
+	list.splice(ThreadList::iterator{threadSet.threads[1]});
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 3, 5, 1, 0, 4});
+
+	// change of deadline
+	threadSet.threads[3].setDeadline(TickClock::time_point{TickClock::duration{400}});
+	reposition(list, threadSet.threads[3], false);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 5, 1, 3, 0, 4});
+	threadSet.threads[4].setDeadline(TickClock::time_point{TickClock::duration{50}});
+	reposition(list, threadSet.threads[4], false);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 4, 5, 1, 3, 0});
+
+	// lowering of priority to the head of the group places the thread before threads with the same deadline only
+	threadSet.threads[2].setPriority(10);
+	threadSet.threads[2].setDeadline(TickClock::time_point{TickClock::duration{300}});
+	reposition(list, threadSet.threads[2], true);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{4, 2, 5, 1, 3, 0});
+
+	while (list.empty() == false)
+		list.erase(list.begin());
+}
+
+TEST_CASE("Testing equivalence of PriorityBitmapThreadList with ThreadList", "[equivalence]")
+{
+	for (const auto seed : {1u, 2u, 3u, 0xdeadbeefu})
+	{
+		ThreadSet threadListThreadSet;
+		ThreadSet priorityBitmapThreadListThreadSet;
+		const auto threadListResults = runSequence<ThreadList>(seed, threadListThreadSet);
+		const auto priorityBitmapThreadListResults = runSequence<PriorityBitmapThreadList>(seed,
+				priorityBitmapThreadListThreadSet);
+		REQUIRE(threadListResults.size() == priorityBitmapThreadListResults.size());
+		for (size_t i {}; i < threadListResults.size(); ++i)
+		{
+			CAPTURE(seed, i);
+			REQUIRE(threadListResults[i] == priorityBitmapThreadListResults[i]);
+		}
+	}
+}
@@ -0,0 +1,196 @@
+/**
+ * \file
+ * \brief InterruptMaskingMonitor test cases
+ *
+ * This test checks whether InterruptMaskingMonitor properly measures periods during which interrupt masking is enabled
+ * (including nested locks and temporary unmasking) and whether it properly maintains the histogram and the worst-case
+ * record.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/synchronization/InterruptMaskingMonitor.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+using distortos::architecture::GetCycleCountMock;
+using distortos::internal::InterruptMaskingMonitor;
+using distortos::statistics::InterruptMaskingStatistics;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// objects whose addresses are used as addresses of code which enables interrupt masking
+const char callSites[2] {};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initial state", "[initial]")
+{
+	const InterruptMaskingMonitor interruptMaskingMonitor;
+	const auto& statistics = interruptMaskingMonitor.getStatistics();
+	for (auto& bucket : statistics.histogram)
+		REQUIRE(bucket == 0);
+	REQUIRE(statistics.worstCaseAddress == nullptr);
+	REQUIRE(statistics.worstCaseDuration == 0);
+}
+
+TEST_CASE("Testing histogram", "[histogram]")
+{
+	GetCycleCountMock getCycleCountMock;
+	trompeloeil::sequence sequence {};
+
+	InterruptMaskingMonitor interruptMaskingMonitor;
+	const auto& statistics = interruptMaskingMonitor.getStatistics();
+
+	const std::pair<uint32_t, size_t> durations[]
+	{
+			{0, 0},
+			{31, 0},
+			{32, 1},
+			{63, 1},
+			{64, 2},
+			{(1 << 18) - 1, 13},
+			{1 << 18, 14},
+			{1 << 19, 15},
+			{UINT32_MAX, 15},
+	};
+
+	std::array<uint32_t, InterruptMaskingStatistics::histogramBuckets> expectedHistogram {};
+	uint32_t start {0xfffff000};
+	for (auto& duration : durations)
+	{
+		DYNAMIC_SECTION("Period of " << duration.first << " cycles should be counted in bucket " << duration.second)
+		{
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(start);
+			interruptMaskingMonitor.enter(&callSites[0]);
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(start + duration.first);
+			interruptMaskingMonitor.exit();
+			++expectedHistogram[duration.second];
+			REQUIRE(statistics.histogram == expectedHistogram);
+			REQUIRE(statistics.worstCaseDuration == duration.first);
+			REQUIRE(statistics.worstCaseAddress == &callSites[0]);
+		}
+		start += 0x12345;
+	}
+}
+
+TEST_CASE("Testing nesting", "[nesting]")
+{
+	GetCycleCountMock getCycleCountMock;
+	trompeloeil::sequence sequence {};
+
+	InterruptMaskingMonitor interruptMaskingMonitor;
+	const auto& statistics = interruptMaskingMonitor.getStatistics();
+
+	SECTION("Nested locks should not start new periods")
+	{
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1000);
+		interruptMaskingMonitor.enter(&callSites[0]);
+		interruptMaskingMonitor.enter(&callSites[0]);
+		interruptMaskingMonitor.enter(&callSites[0]);
+		interruptMaskingMonitor.exit();
+		interruptMaskingMonitor.exit();
+		REQUIRE(statistics.worstCaseAddress == nullptr);
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1100);
+		interruptMaskingMonitor.exit();
+		REQUIRE(statistics.histogram[2] == 1);
+		REQUIRE(statistics.worstCaseDuration == 100);
+	}
+	SECTION("Temporary unmasking should end current period and start a new one")
+	{
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1000);
+		interruptMaskingMonitor.enter(&callSites[0]);
+		interruptMaskingMonitor.enter(&callSites[0]);
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1040);
+		const auto depth = interruptMaskingMonitor.pause();
+		REQUIRE(depth == 2);
+		REQUIRE(statistics.histogram[1] == 1);
+		REQUIRE(statistics.worstCaseDuration == 40);
+
+		{
+			// lock used when interrupt masking is temporarily disabled is the outermost one
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(5000);
+			interruptMaskingMonitor.enter(&callSites[0]);
+			REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(5010);
+			interruptMaskingMonitor.exit();
+			REQUIRE(statistics.histogram[0] == 1);
+			REQUIRE(statistics.worstCaseDuration == 40);
+		}
+
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(9000);
+		interruptMaskingMonitor.resume(depth, &callSites[1]);
+		interruptMaskingMonitor.exit();
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(9200);
+		interruptMaskingMonitor.exit();
+		REQUIRE(statistics.histogram[3] == 1);
+		REQUIRE(statistics.worstCaseAddress == &callSites[1]);
+		REQUIRE(statistics.worstCaseDuration == 200);
+	}
+	SECTION("Unmasking when interrupt masking is disabled should do nothing")
+	{
+		const auto depth = interruptMaskingMonitor.pause();
+		REQUIRE(depth == 0);
+		interruptMaskingMonitor.resume(depth, &callSites[1]);
+		REQUIRE(statistics.worstCaseAddress == nullptr);
+		for (auto& bucket : statistics.histogram)
+			REQUIRE(bucket == 0);
+	}
+}
+
+TEST_CASE("Testing worst-case record", "[worst-case]")
+{
+	GetCycleCountMock getCycleCountMock;
+	trompeloeil::sequence sequence {};
+
+	InterruptMaskingMonitor interruptMaskingMonitor;
+	const auto& statistics = interruptMaskingMonitor.getStatistics();
+
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(0);
+	interruptMaskingMonitor.enter(&callSites[0]);
+	REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(500);
+	interruptMaskingMonitor.exit();
+	REQUIRE(statistics.worstCaseAddress == &callSites[0]);
+	REQUIRE(statistics.worstCaseDuration == 500);
+
+	SECTION("Shorter period should not replace the worst-case record")
+	{
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1000);
+		interruptMaskingMonitor.enter(&callSites[1]);
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1499);
+		interruptMaskingMonitor.exit();
+		REQUIRE(statistics.worstCaseAddress == &callSites[0]);
+		REQUIRE(statistics.worstCaseDuration == 500);
+	}
+	SECTION("Longer period should replace the worst-case record")
+	{
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1000);
+		interruptMaskingMonitor.enter(&callSites[1]);
+		REQUIRE_CALL(getCycleCountMock, getCycleCount()).IN_SEQUENCE(sequence).RETURN(1501);
+		interruptMaskingMonitor.exit();
+		REQUIRE(statistics.worstCaseAddress == &callSites[1]);
+		REQUIRE(statistics.worstCaseDuration == 501);
+	}
+	SECTION("Reset should clear all statistics")
+	{
+		interruptMaskingMonitor.reset();
+		REQUIRE(statistics.worstCaseAddress == nullptr);
+		REQUIRE(statistics.worstCaseDuration == 0);
+		for (auto& bucket : statistics.histogram)
+			REQUIRE(bucket == 0);
+	}
+}
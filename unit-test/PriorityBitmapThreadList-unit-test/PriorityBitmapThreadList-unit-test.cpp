@@ -0,0 +1,293 @@
+/**
+ * \file
+ * \brief PriorityBitmapThreadList test cases
+ *
+ * This test checks whether PriorityBitmapThreadList keeps exactly the same order of elements as ThreadList for all
+ * operations used by the scheduler. It also compares the performance of both containers.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/PriorityBitmapThreadList.hpp"
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <deque>
+#include <random>
+
+using distortos::internal::PriorityBitmapThreadList;
+using distortos::internal::ThreadControlBlock;
+using distortos::internal::ThreadList;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// set of threads linked either in the tested list or in the "blocked" list
+struct ThreadSet
+{
+	/// threads
+	std::deque<ThreadControlBlock> threads;
+
+	/// "blocked" list
+	ThreadList blockedList;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets indexes of threads linked in the list.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadSet is a reference to set of threads
+ *
+ * \return vector with indexes (in \a threadSet) of threads linked in \a list
+ */
+
+template<typename List>
+std::vector<size_t> getIndexes(const List& list, const ThreadSet& threadSet)
+{
+	std::vector<size_t> indexes;
+	for (auto& thread : list)
+		for (size_t i {}; i < threadSet.threads.size(); ++i)
+			if (&threadSet.threads[i] == &thread)
+				indexes.emplace_back(i);
+	return indexes;
+}
+
+/**
+ * \brief Repositions the thread in sorted ThreadList - the same way as ThreadControlBlock::reposition() does.
+ *
+ * \param [in] list is a reference to list
+ * \param [in] thread is a reference to repositioned thread
+ * \param [in] loweringBefore selects the method of ordering when lowering the priority
+ */
+
+void reposition(ThreadList& list, ThreadControlBlock& thread, const bool loweringBefore)
+{
+	const auto priority = thread.getPriority();
+	if (loweringBefore == true)
+		thread.setPriority(priority + 1);
+	list.splice(ThreadList::iterator{thread});
+	thread.setPriority(priority);
+}
+
+/**
+ * \brief Repositions the thread in PriorityBitmapThreadList.
+ *
+ * \param [in] list is a reference to list
+ * \param [in] thread is a reference to repositioned thread
+ * \param [in] loweringBefore selects the method of ordering when lowering the priority
+ */
+
+void reposition(PriorityBitmapThreadList& list, ThreadControlBlock& thread, const bool loweringBefore)
+{
+	list.reposition(ThreadList::iterator{thread}, loweringBefore);
+}
+
+/**
+ * \brief Blocks the thread, transferring it from tested list to "blocked" list.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadSet is a reference to set of threads
+ * \param [in] thread is a reference to blocked thread
+ */
+
+template<typename List>
+void block(List& list, ThreadSet& threadSet, ThreadControlBlock& thread)
+{
+	list.erase(ThreadList::iterator{thread});
+	threadSet.blockedList.insert(thread);
+}
+
+/**
+ * \brief Runs the same pseudo-random sequence of operations on tested list and checks its contents after each step.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] seed is the seed for pseudo-random number generator
+ * \param [in] threadSet is a reference to set of threads
+ *
+ * \return vector with indexes of threads linked in tested list after each step
+ */
+
+template<typename List>
+std::vector<std::vector<size_t>> runSequence(const unsigned int seed, ThreadSet& threadSet)
+{
+	std::vector<std::vector<size_t>> results;
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<int> priorityDistribution {0, UINT8_MAX};
+	std::uniform_int_distribution<int> operationDistribution {0, 5};
+	List list;
+	std::vector<ThreadControlBlock*> runnable;
+
+	for (size_t step {}; step < 2000; ++step)
+	{
+		runnable.clear();
+		for (auto& thread : list)
+			runnable.emplace_back(&thread);
+		std::uniform_int_distribution<size_t> runnableDistribution {0, runnable.empty() == false ?
+				runnable.size() - 1 : 0};
+		const auto operation = runnable.empty() == true ? 0 : operationDistribution(generator);
+		if (operation == 0 && threadSet.threads.size() < 300)	// add new thread
+		{
+			threadSet.threads.emplace_back(priorityDistribution(generator));
+			list.insert(threadSet.threads.back());
+		}
+		else if (operation == 1)	// block thread
+			block(list, threadSet, *runnable[runnableDistribution(generator)]);
+		else if (operation == 2 && threadSet.blockedList.empty() == false)	// unblock thread
+			list.splice(threadSet.blockedList.begin());
+		else if (operation == 3)	// round-robin rotation
+			list.splice(ThreadList::iterator{*runnable[runnableDistribution(generator)]});
+		else if (operation >= 4)	// change of priority
+		{
+			auto& thread = *runnable[runnableDistribution(generator)];
+			const auto oldPriority = thread.getPriority();
+			thread.setPriority(priorityDistribution(generator));
+			if (thread.getPriority() != oldPriority)
+				reposition(list, thread, operation == 5 && thread.getPriority() < oldPriority);
+		}
+
+		results.emplace_back(getIndexes(list, threadSet));
+	}
+
+	return results;
+}
+
+/**
+ * \brief Fills the list with threads.
+ *
+ * Threads have different priorities, the lowest priority is 0.
+ *
+ * \tparam List is the type of list
+ *
+ * \param [in] list is a reference to list
+ * \param [in] threadSet is a reference to set of threads
+ * \param [in] count is the number of threads
+ */
+
+template<typename List>
+void fill(List& list, ThreadSet& threadSet, const size_t count)
+{
+	for (size_t i {}; i < count; ++i)
+	{
+		threadSet.threads.emplace_back((count - 1 - i) * UINT8_MAX / (count - 1));
+		list.insert(threadSet.threads.back());
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing basic operations", "[basic]")
+{
+	ThreadSet threadSet;
+	threadSet.threads.emplace_back(10);
+	threadSet.threads.emplace_back(20);
+	threadSet.threads.emplace_back(10);
+	threadSet.threads.emplace_back(30);
+	threadSet.threads.emplace_back(20);
+
+	PriorityBitmapThreadList list;
+	REQUIRE(list.empty() == true);
+	for (auto& thread : threadSet.threads)
+		list.insert(thread);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{3, 1, 4, 0, 2});
+
+	// round-robin rotation
+	list.splice(list.begin());
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{3, 1, 4, 0, 2});
+	list.splice(ThreadList::iterator{threadSet.threads[1]});
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{3, 4, 1, 0, 2});
+
+	// lowering of priority, to the head and to the tail of the group
+	threadSet.threads[3].setPriority(10);
+	list.reposition(ThreadList::iterator{threadSet.threads[3]}, true);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{4, 1, 3, 0, 2});
+	threadSet.threads[1].setPriority(10);
+	list.reposition(ThreadList::iterator{threadSet.threads[1]}, false);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{4, 3, 0, 2, 1});
+
+	// raising of priority
+	threadSet.threads[2].setPriority(UINT8_MAX);
+	list.reposition(ThreadList::iterator{threadSet.threads[2]}, false);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{2, 4, 3, 0, 1});
+
+	// blocking and unblocking
+	block(list, threadSet, threadSet.threads[3]);
+	block(list, threadSet, threadSet.threads[2]);
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{4, 0, 1});
+	threadSet.threads[2].setPriority(0);
+	list.splice(ThreadList::iterator{threadSet.threads[2]});
+	list.splice(ThreadList::iterator{threadSet.threads[3]});
+	REQUIRE(getIndexes(list, threadSet) == std::vector<size_t>{4, 0, 1, 3, 2});
+	REQUIRE(threadSet.blockedList.empty() == true);
+
+	while (list.empty() == false)
+		list.erase(list.begin());
+}
+
+TEST_CASE("Testing equivalence with ThreadList", "[equivalence]")
+{
+	for (const auto seed : {1u, 2u, 3u, 0xdeadbeefu})
+	{
+		ThreadSet threadListThreadSet;
+		ThreadSet priorityBitmapThreadListThreadSet;
+		const auto threadListResults = runSequence<ThreadList>(seed, threadListThreadSet);
+		const auto priorityBitmapThreadListResults = runSequence<PriorityBitmapThreadList>(seed,
+				priorityBitmapThreadListThreadSet);
+		REQUIRE(threadListResults.size() == priorityBitmapThreadListResults.size());
+		for (size_t i {}; i < threadListResults.size(); ++i)
+		{
+			CAPTURE(seed, i);
+			REQUIRE(threadListResults[i] == priorityBitmapThreadListResults[i]);
+		}
+	}
+}
+
+TEST_CASE("Comparing performance with ThreadList", "[benchmark]")
+{
+	for (const size_t count : {8, 64, 255})
+	{
+		ThreadSet threadListThreadSet;
+		ThreadList threadList;
+		fill(threadList, threadListThreadSet, count);
+		ThreadSet priorityBitmapThreadListThreadSet;
+		PriorityBitmapThreadList priorityBitmapThreadList;
+		fill(priorityBitmapThreadList, priorityBitmapThreadListThreadSet, count);
+
+		// block and unblock the lowest priority thread - worst case for ThreadList
+		BENCHMARK("ThreadList, " + std::to_string(count) + " threads")
+		{
+			block(threadList, threadListThreadSet, threadListThreadSet.threads.back());
+			threadList.splice(threadListThreadSet.blockedList.begin());
+		};
+		BENCHMARK("PriorityBitmapThreadList, " + std::to_string(count) + " threads")
+		{
+			block(priorityBitmapThreadList, priorityBitmapThreadListThreadSet,
+					priorityBitmapThreadListThreadSet.threads.back());
+			priorityBitmapThreadList.splice(priorityBitmapThreadListThreadSet.blockedList.begin());
+		};
+
+		REQUIRE(getIndexes(threadList, threadListThreadSet) ==
+				getIndexes(priorityBitmapThreadList, priorityBitmapThreadListThreadSet));
+	}
+}
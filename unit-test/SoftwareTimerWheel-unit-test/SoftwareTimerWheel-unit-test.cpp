@@ -0,0 +1,384 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel test cases
+ *
+ * This test checks whether SoftwareTimerWheel expires software timers in exactly the same order as SoftwareTimerList
+ * (used the same way as in SoftwareTimerSupervisor). It also compares the performance of both containers.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerList.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#include <deque>
+#include <random>
+
+using distortos::TickClock;
+using distortos::internal::SoftwareTimerControlBlock;
+using distortos::internal::SoftwareTimerList;
+using distortos::internal::SoftwareTimerWheel;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// wrapper for SoftwareTimerList with the same interface as SoftwareTimerWheel
+class ListWrapper
+{
+public:
+
+	/**
+	 * \brief Advances current time point and expires software timers - the same way as SoftwareTimerSupervisor does.
+	 *
+	 * \param [in] timePoint is the new time point
+	 * \param [in] functor is a functor called for each expired software timer, it may start software timers again
+	 */
+
+	template<typename Functor>
+	void advance(const TickClock::time_point timePoint, Functor&& functor)
+	{
+		decltype(list_.begin()) iterator;
+		while (iterator = list_.begin(), iterator != list_.end() && iterator->getTimePoint() <= timePoint)
+		{
+			auto& softwareTimer = *iterator;
+			SoftwareTimerList::erase(iterator);
+			functor(softwareTimer);
+		}
+	}
+
+	/**
+	 * \return time point of the nearest software timer, TickClock::time_point::max() if the list is empty
+	 */
+
+	TickClock::time_point getNextTimePoint() const
+	{
+		return list_.empty() == false ? list_.begin()->getTimePoint() : TickClock::time_point::max();
+	}
+
+	/**
+	 * \brief Links software timer in the list.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer that will be linked
+	 */
+
+	void insert(SoftwareTimerControlBlock& softwareTimer)
+	{
+		list_.insert(softwareTimer);
+	}
+
+private:
+
+	/// sorted list of software timers
+	SoftwareTimerList list_;
+};
+
+/// wrapper for SoftwareTimerWheel with the same interface as ListWrapper
+class WheelWrapper
+{
+public:
+
+	/**
+	 * \brief Advances current time point and expires software timers - the same way as SoftwareTimerSupervisor does.
+	 *
+	 * \param [in] timePoint is the new time point
+	 * \param [in] functor is a functor called for each expired software timer, it may start software timers again
+	 */
+
+	template<typename Functor>
+	void advance(const TickClock::time_point timePoint, Functor&& functor)
+	{
+		wheel_.advance(timePoint);
+		auto& expiredList = wheel_.getExpiredList();
+		while (expiredList.empty() == false)
+		{
+			auto& softwareTimer = expiredList.front();
+			expiredList.pop_front();
+			functor(softwareTimer);
+		}
+	}
+
+	/**
+	 * \return time point of the nearest software timer, TickClock::time_point::max() if the wheel is empty
+	 */
+
+	TickClock::time_point getNextTimePoint() const
+	{
+		return wheel_.getNextTimePoint();
+	}
+
+	/**
+	 * \brief Links software timer in the wheel.
+	 *
+	 * \param [in] softwareTimer is a reference to software timer that will be linked
+	 */
+
+	void insert(SoftwareTimerControlBlock& softwareTimer)
+	{
+		wheel_.insert(softwareTimer);
+	}
+
+private:
+
+	/// timing wheel of software timers
+	SoftwareTimerWheel wheel_;
+};
+
+/// results of one step of pseudo-random sequence
+struct StepResult
+{
+	/// indexes of software timers expired in this step, in the order of expiration
+	std::vector<size_t> expired;
+
+	/// time point of the nearest software timer after this step
+	TickClock::time_point nextTimePoint;
+
+	/**
+	 * \brief StepResult's equality operator
+	 *
+	 * \param [in] other is a reference to other StepResult object
+	 *
+	 * \return true if both objects are equal, false otherwise
+	 */
+
+	bool operator==(const StepResult& other) const
+	{
+		return expired == other.expired && nextTimePoint == other.nextTimePoint;
+	}
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets index of software timer.
+ *
+ * \param [in] softwareTimers is a reference to container with software timers
+ * \param [in] softwareTimer is a reference to software timer
+ *
+ * \return index of \a softwareTimer in \a softwareTimers
+ */
+
+size_t getIndex(const std::deque<SoftwareTimerControlBlock>& softwareTimers,
+		const SoftwareTimerControlBlock& softwareTimer)
+{
+	for (size_t i {}; i < softwareTimers.size(); ++i)
+		if (&softwareTimers[i] == &softwareTimer)
+			return i;
+	FAIL("Software timer not found");
+	return {};
+}
+
+/**
+ * \brief Starts software timer.
+ *
+ * \tparam Container is the type of container of software timers
+ *
+ * \param [in] container is a reference to container of software timers
+ * \param [in] softwareTimer is a reference to software timer that will be started
+ * \param [in] timePoint is the expiration time point of software timer
+ */
+
+template<typename Container>
+void start(Container& container, SoftwareTimerControlBlock& softwareTimer, const TickClock::time_point timePoint)
+{
+	softwareTimer.setTimePoint(timePoint);
+	container.insert(softwareTimer);
+}
+
+/**
+ * \brief Runs the same pseudo-random sequence of operations on tested container.
+ *
+ * \tparam Container is the type of container of software timers
+ *
+ * \param [in] seed is the seed for pseudo-random number generator
+ *
+ * \return vector with results of each step
+ */
+
+template<typename Container>
+std::vector<StepResult> runSequence(const unsigned int seed)
+{
+	std::vector<StepResult> results;
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<int> operationDistribution {0, 9};
+	std::uniform_int_distribution<int> rangeDistribution {0, 3};
+	std::uniform_int_distribution<int> restartDistribution {0, 3};
+	std::deque<SoftwareTimerControlBlock> softwareTimers;
+	Container container;
+	TickClock::time_point now {};
+
+	const auto getDuration = [&generator, &rangeDistribution]()
+			{
+				constexpr TickClock::rep ranges[] {8, 100, 5000, 3000000};
+				std::uniform_int_distribution<TickClock::rep> distribution {-3, ranges[rangeDistribution(generator)]};
+				return TickClock::duration{distribution(generator)};
+			};
+
+	for (size_t step {}; step < 5000; ++step)
+	{
+		StepResult result {};
+		const auto operation = operationDistribution(generator);
+		if (operation <= 3)	// start new software timer
+		{
+			softwareTimers.emplace_back();
+			start(container, softwareTimers.back(), now + getDuration());
+		}
+		else if (operation == 4 && softwareTimers.empty() == false)	// restart or stop existing software timer
+		{
+			std::uniform_int_distribution<size_t> indexDistribution {0, softwareTimers.size() - 1};
+			auto& softwareTimer = softwareTimers[indexDistribution(generator)];
+			if (softwareTimer.node.isLinked() == true)
+				softwareTimer.node.unlink();
+			if (restartDistribution(generator) != 0)
+				start(container, softwareTimer, now + getDuration());
+		}
+		else	// advance time, possibly to the next time point
+		{
+			const auto nextTimePoint = container.getNextTimePoint();
+			if (operation == 9 && nextTimePoint != TickClock::time_point::max() && nextTimePoint > now)
+				now = nextTimePoint;
+			else
+				now += TickClock::duration{operation == 8 ? 1000 : 1};
+
+			container.advance(now, [&](SoftwareTimerControlBlock& softwareTimer)
+					{
+						result.expired.emplace_back(getIndex(softwareTimers, softwareTimer));
+						// some expired software timers are restarted, like periodic ones
+						const auto restart = restartDistribution(generator);
+						if (restart == 0)
+							start(container, softwareTimer, softwareTimer.getTimePoint() + TickClock::duration{1});
+						else if (restart == 1)
+							start(container, softwareTimer, now - TickClock::duration{1});
+					});
+		}
+
+		result.nextTimePoint = container.getNextTimePoint();
+		results.emplace_back(std::move(result));
+	}
+
+	for (auto& softwareTimer : softwareTimers)
+		if (softwareTimer.node.isLinked() == true)
+			softwareTimer.node.unlink();
+
+	return results;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing basic operations", "[basic]")
+{
+	std::deque<SoftwareTimerControlBlock> softwareTimers {6};
+	WheelWrapper wheel;
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point::max());
+
+	start(wheel, softwareTimers[0], TickClock::time_point{TickClock::duration{40}});
+	start(wheel, softwareTimers[1], TickClock::time_point{TickClock::duration{5}});
+	start(wheel, softwareTimers[2], TickClock::time_point{TickClock::duration{40}});
+	start(wheel, softwareTimers[3], TickClock::time_point{TickClock::duration{2000000}});
+	start(wheel, softwareTimers[4], TickClock::time_point{TickClock::duration{1100}});
+	start(wheel, softwareTimers[5], TickClock::time_point{TickClock::duration{1100}});
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point{TickClock::duration{5}});
+
+	std::vector<size_t> expired;
+	const auto advance = [&softwareTimers, &wheel, &expired](const TickClock::rep ticks)
+			{
+				expired.clear();
+				wheel.advance(TickClock::time_point{TickClock::duration{ticks}},
+						[&softwareTimers, &expired](SoftwareTimerControlBlock& softwareTimer)
+						{
+							expired.emplace_back(getIndex(softwareTimers, softwareTimer));
+						});
+				return expired;
+			};
+
+	REQUIRE(advance(4) == std::vector<size_t>{});
+	REQUIRE(advance(5) == std::vector<size_t>{1});
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point{TickClock::duration{40}});
+
+	// stopping of software timer
+	softwareTimers[4].node.unlink();
+	REQUIRE(advance(1099) == (std::vector<size_t>{0, 2}));
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point{TickClock::duration{1100}});
+	REQUIRE(advance(1100) == std::vector<size_t>{5});
+
+	// software timer in the past is expired in the next step, before the ones at current time point
+	start(wheel, softwareTimers[0], TickClock::time_point{TickClock::duration{1101}});
+	start(wheel, softwareTimers[1], TickClock::time_point{TickClock::duration{1000}});
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point{TickClock::duration{1000}});
+	REQUIRE(advance(1101) == (std::vector<size_t>{1, 0}));
+
+	// software timer in the "overflow" list
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point{TickClock::duration{2000000}});
+	REQUIRE(advance(1999999) == std::vector<size_t>{});
+	REQUIRE(advance(2000001) == std::vector<size_t>{3});
+	REQUIRE(wheel.getNextTimePoint() == TickClock::time_point::max());
+}
+
+TEST_CASE("Testing equivalence with SoftwareTimerList", "[equivalence]")
+{
+	for (const auto seed : {1u, 2u, 3u, 0xdeadbeefu})
+	{
+		const auto listResults = runSequence<ListWrapper>(seed);
+		const auto wheelResults = runSequence<WheelWrapper>(seed);
+		REQUIRE(listResults.size() == wheelResults.size());
+		for (size_t i {}; i < listResults.size(); ++i)
+		{
+			CAPTURE(seed, i);
+			REQUIRE(listResults[i] == wheelResults[i]);
+		}
+	}
+}
+
+TEST_CASE("Comparing performance with SoftwareTimerList", "[benchmark]")
+{
+	for (const size_t count : {8, 64, 512})
+	{
+		std::deque<SoftwareTimerControlBlock> listSoftwareTimers {count + 1};
+		ListWrapper list;
+		std::deque<SoftwareTimerControlBlock> wheelSoftwareTimers {count + 1};
+		WheelWrapper wheel;
+		for (size_t i {}; i < count; ++i)
+		{
+			const TickClock::time_point timePoint {TickClock::duration{static_cast<TickClock::rep>(i + 1)}};
+			start(list, listSoftwareTimers[i], timePoint);
+			start(wheel, wheelSoftwareTimers[i], timePoint);
+		}
+
+		// start and stop software timer with the latest expiration time point - worst case for SoftwareTimerList
+		const TickClock::time_point timePoint {TickClock::duration{static_cast<TickClock::rep>(count + 1)}};
+		BENCHMARK("SoftwareTimerList, " + std::to_string(count) + " software timers")
+		{
+			start(list, listSoftwareTimers.back(), timePoint);
+			listSoftwareTimers.back().node.unlink();
+		};
+		BENCHMARK("SoftwareTimerWheel, " + std::to_string(count) + " software timers")
+		{
+			start(wheel, wheelSoftwareTimers.back(), timePoint);
+			wheelSoftwareTimers.back().node.unlink();
+		};
+
+		REQUIRE(list.getNextTimePoint() == wheel.getNextTimePoint());
+		for (auto& softwareTimer : listSoftwareTimers)
+			if (softwareTimer.node.isLinked() == true)
+				softwareTimer.node.unlink();
+		for (auto& softwareTimer : wheelSoftwareTimers)
+			if (softwareTimer.node.isLinked() == true)
+				softwareTimer.node.unlink();
+	}
+}
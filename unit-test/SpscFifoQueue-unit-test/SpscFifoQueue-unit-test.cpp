@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \brief SpscFifoQueue test cases
+ *
+ * This test checks whether SpscFifoQueue properly handles full and empty states, keeps the FIFO order of elements
+ * across wrap-around of positions and destructs elements. Stress test with separate producer and consumer threads
+ * checks that no element is lost, duplicated or reordered and that blocked consumer is always woken up.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/SpscFifoQueue.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements transferred in stress test
+constexpr uint32_t stressTestElements {1000000};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing full and empty queue", "[full-empty]")
+{
+	distortos::SpscFifoQueue<uint32_t, 4> queue;
+	REQUIRE(queue.getCapacity() == 4);
+	REQUIRE(queue.getSize() == 0);
+
+	uint32_t value {};
+	REQUIRE(queue.tryPop(value) == EAGAIN);
+
+	for (uint32_t i {}; i < queue.getCapacity(); ++i)
+	{
+		REQUIRE(queue.tryPush(i) == 0);
+		REQUIRE(queue.getSize() == i + 1);
+	}
+	REQUIRE(queue.tryPush(uint32_t{}) == EAGAIN);
+
+	for (uint32_t i {}; i < queue.getCapacity(); ++i)
+	{
+		REQUIRE(queue.tryPop(value) == 0);
+		REQUIRE(value == i);
+	}
+	REQUIRE(queue.getSize() == 0);
+	REQUIRE(queue.tryPop(value) == EAGAIN);
+}
+
+TEST_CASE("Testing FIFO order with wrap-around", "[order]")
+{
+	distortos::SpscFifoQueue<uint32_t, 4> queue;
+	uint32_t pushed {};
+	uint32_t popped {};
+
+	for (size_t cycle {}; cycle < 25; ++cycle)
+	{
+		// interleave pushes and pops with varying fill level, so that each slot is used at various positions
+		const auto pushes = cycle % queue.getCapacity() + 1;
+		for (size_t i {}; i < pushes && queue.getSize() != queue.getCapacity(); ++i)
+			REQUIRE(queue.tryPush(pushed++) == 0);
+
+		const auto pops = (cycle + 2) % queue.getCapacity() + 1;
+		for (size_t i {}; i < pops && queue.getSize() != 0; ++i)
+		{
+			uint32_t value {};
+			REQUIRE(queue.pop(value) == 0);
+			REQUIRE(value == popped++);
+		}
+	}
+
+	uint32_t value {};
+	while (queue.tryPop(value) == 0)
+		REQUIRE(value == popped++);
+	REQUIRE(popped == pushed);
+}
+
+TEST_CASE("Testing destruction of elements", "[destruction]")
+{
+	const auto object = std::make_shared<int>();
+
+	{
+		distortos::SpscFifoQueue<std::shared_ptr<int>, 4> queue;
+		REQUIRE(queue.tryPush(object) == 0);
+		REQUIRE(queue.tryEmplace(object) == 0);
+		REQUIRE(queue.tryPush(object) == 0);
+		REQUIRE(object.use_count() == 4);
+
+		std::shared_ptr<int> value;
+		REQUIRE(queue.tryPop(value) == 0);
+		REQUIRE(object.use_count() == 4);
+		value.reset();
+		REQUIRE(object.use_count() == 3);
+	}
+
+	REQUIRE(object.use_count() == 1);
+}
+
+TEST_CASE("Testing producer and consumer threads", "[stress]")
+{
+	distortos::SpscFifoQueue<uint32_t, 16> queue;
+
+	std::thread producer {[&queue]()
+			{
+				for (uint32_t i {}; i < stressTestElements; ++i)
+					while (queue.tryPush(i) != 0)
+						std::this_thread::yield();
+			}};
+
+	uint32_t mismatches {};
+	for (uint32_t i {}; i < stressTestElements; ++i)
+	{
+		uint32_t value {};
+		const auto ret = queue.pop(value);
+		if (ret != 0 || value != i)
+			++mismatches;
+	}
+
+	producer.join();
+
+	REQUIRE(mismatches == 0);
+	REQUIRE(queue.getSize() == 0);
+}
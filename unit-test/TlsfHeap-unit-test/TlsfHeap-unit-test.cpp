@@ -0,0 +1,452 @@
+/**
+ * \file
+ * \brief TlsfHeap test cases
+ *
+ * This test checks whether TlsfHeap properly allocates, deallocates and resizes blocks, whether adjacent free blocks
+ * are merged and whether statistics are properly maintained. It also measures fragmentation after a pseudo-random
+ * workload and compares the performance of TlsfHeap with host's malloc() and free().
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/memory/TlsfHeap.hpp"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+using distortos::internal::TlsfHeap;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// memory region used for the heap
+struct alignas(std::max_align_t) Region
+{
+	/// storage of the region
+	uint8_t storage[256 * 1024];
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// alignment of all blocks, bytes
+constexpr size_t alignment {alignof(std::max_align_t)};
+
+/// size of header of each block, bytes
+constexpr size_t headerSize {(sizeof(void*) + sizeof(size_t) + alignment - 1) / alignment * alignment};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether heap is empty.
+ *
+ * \param [in] tlsfHeap is a reference to tested heap
+ *
+ * \return true if there are no allocated blocks and all free memory is in single block, false otherwise
+ */
+
+bool isEmpty(const TlsfHeap& tlsfHeap)
+{
+	const auto statistics = tlsfHeap.getStatistics();
+	return statistics.usedSize == 0 && statistics.usedBlocks == 0 && statistics.freeBlocks == 1 &&
+			statistics.freeSize == statistics.size && statistics.largestFreeSize == statistics.size &&
+			statistics.fragmentation == 0;
+}
+
+/**
+ * \brief Runs pseudo-random sequence of allocations, deallocations and resizes.
+ *
+ * Contents of each allocated block are filled with a pattern, which is verified before the block is resized or
+ * deallocated.
+ *
+ * \param [in] tlsfHeap is a reference to tested heap
+ * \param [in] seed is the seed for pseudo-random number generator
+ * \param [in] operations is the number of operations
+ * \param [in] maxSize is the max size of single allocation, bytes
+ *
+ * \return map with allocated blocks (pointer to memory and its size) which are left when the sequence ends
+ */
+
+std::map<uint8_t*, size_t> runRandomSequence(TlsfHeap& tlsfHeap, const unsigned int seed, const size_t operations,
+		const size_t maxSize)
+{
+	std::mt19937 generator {seed};
+	std::uniform_int_distribution<size_t> sizeDistribution {0, maxSize};
+	std::uniform_int_distribution<int> operationDistribution {0, 5};
+	std::map<uint8_t*, size_t> blocks;
+
+	const auto fill = [](uint8_t* const memory, const size_t size)
+			{
+				for (size_t i {}; i < size; ++i)
+					memory[i] = reinterpret_cast<uintptr_t>(memory) + i;
+			};
+	const auto verify = [](const uint8_t* const memory, const size_t size)
+			{
+				for (size_t i {}; i < size; ++i)
+					if (memory[i] != static_cast<uint8_t>(reinterpret_cast<uintptr_t>(memory) + i))
+						return false;
+				return true;
+			};
+
+	for (size_t i {}; i < operations; ++i)
+	{
+		const auto operation = operationDistribution(generator);
+		if (blocks.empty() == true || operation < 3)
+		{
+			const auto size = sizeDistribution(generator);
+			const auto memory = static_cast<uint8_t*>(operation == 0 ?
+					tlsfHeap.allocateAligned(alignment * 4, size) : tlsfHeap.allocate(size));
+			if (memory == nullptr)
+				continue;
+
+			REQUIRE(reinterpret_cast<uintptr_t>(memory) % (operation == 0 ? alignment * 4 : alignment) == 0);
+			REQUIRE(TlsfHeap::getUsableSize(memory) >= size);
+			fill(memory, size);
+			blocks.emplace(memory, size);
+			continue;
+		}
+
+		auto iterator = blocks.begin();
+		std::advance(iterator, std::uniform_int_distribution<size_t>{0, blocks.size() - 1}(generator));
+		REQUIRE(verify(iterator->first, iterator->second) == true);
+
+		if (operation == 3)
+		{
+			const auto size = sizeDistribution(generator);
+			if (tlsfHeap.resize(iterator->first, size) == true)
+			{
+				REQUIRE(TlsfHeap::getUsableSize(iterator->first) >= size);
+				fill(iterator->first, size);
+				iterator->second = size;
+			}
+			continue;
+		}
+
+		tlsfHeap.deallocate(iterator->first);
+		blocks.erase(iterator);
+	}
+
+	for (const auto& block : blocks)
+		REQUIRE(verify(block.first, block.second) == true);
+
+	// all memory of the heap must be accounted for, each block except the first one consumes a header
+	const auto statistics = tlsfHeap.getStatistics();
+	REQUIRE(statistics.usedSize + statistics.freeSize +
+			(statistics.usedBlocks + statistics.freeBlocks - 1) * headerSize == statistics.size);
+	REQUIRE(statistics.largestFreeSize <= statistics.freeSize);
+
+	// blocks must not overlap
+	for (auto iterator = blocks.begin(); iterator != blocks.end() && std::next(iterator) != blocks.end(); ++iterator)
+		REQUIRE(iterator->first + TlsfHeap::getUsableSize(iterator->first) <= std::next(iterator)->first);
+
+	return blocks;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing initialization", "[initialization]")
+{
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.isInitialized() == false);
+	REQUIRE(tlsfHeap.allocate(1) == nullptr);
+	REQUIRE(tlsfHeap.getStatistics().size == 0);
+
+	alignas(std::max_align_t) uint8_t storage[1024];
+
+	SECTION("Too small region must be rejected")
+	{
+		REQUIRE(tlsfHeap.initialize(storage, 2 * sizeof(void*)) == false);
+		REQUIRE(tlsfHeap.isInitialized() == false);
+	}
+	SECTION("Misaligned region must be aligned")
+	{
+		REQUIRE(tlsfHeap.initialize(storage + 1, sizeof(storage) - 1) == true);
+		REQUIRE(tlsfHeap.isInitialized() == true);
+		const auto statistics = tlsfHeap.getStatistics();
+		REQUIRE(statistics.size < sizeof(storage) - alignment);
+		REQUIRE(statistics.size % alignment == 0);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+
+		const auto memory = tlsfHeap.allocate(statistics.size);
+		REQUIRE(memory > storage);
+		REQUIRE(static_cast<uint8_t*>(memory) + statistics.size <= storage + sizeof(storage));
+		REQUIRE(tlsfHeap.allocate(1) == nullptr);
+		tlsfHeap.deallocate(memory);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+}
+
+TEST_CASE("Testing allocation and deallocation", "[allocation]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+	const auto size = tlsfHeap.getStatistics().size;
+
+	SECTION("Allocation larger than the heap must fail")
+	{
+		REQUIRE(tlsfHeap.allocate(size + 1) == nullptr);
+		REQUIRE(tlsfHeap.allocate(SIZE_MAX) == nullptr);
+		REQUIRE(tlsfHeap.allocateAligned(alignment * 2, SIZE_MAX) == nullptr);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+	SECTION("Deallocation of nullptr must be ignored")
+	{
+		tlsfHeap.deallocate(nullptr);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+	SECTION("Zero-sized allocations must return unique pointers")
+	{
+		const auto memory1 = tlsfHeap.allocate(0);
+		const auto memory2 = tlsfHeap.allocate(0);
+		REQUIRE(memory1 != nullptr);
+		REQUIRE(memory2 != nullptr);
+		REQUIRE(memory1 != memory2);
+		tlsfHeap.deallocate(memory1);
+		tlsfHeap.deallocate(memory2);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+	SECTION("Adjacent free blocks must be merged")
+	{
+		void* blocks[3];
+		for (auto& block : blocks)
+		{
+			block = tlsfHeap.allocate(100);
+			REQUIRE(block != nullptr);
+		}
+		REQUIRE(tlsfHeap.getStatistics().usedBlocks == 3);
+
+		tlsfHeap.deallocate(blocks[0]);
+		tlsfHeap.deallocate(blocks[2]);
+		{
+			const auto statistics = tlsfHeap.getStatistics();
+			REQUIRE(statistics.usedBlocks == 1);
+			// first block and merged last block with the rest of the heap
+			REQUIRE(statistics.freeBlocks == 2);
+			REQUIRE(statistics.fragmentation != 0);
+		}
+
+		tlsfHeap.deallocate(blocks[1]);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+	SECTION("Freed block must be reused")
+	{
+		const auto memory = tlsfHeap.allocate(1000);
+		const auto guard = tlsfHeap.allocate(1);
+		REQUIRE(memory != nullptr);
+		REQUIRE(guard != nullptr);
+		tlsfHeap.deallocate(memory);
+		REQUIRE(tlsfHeap.allocate(900) == memory);
+	}
+	SECTION("Whole heap must be usable")
+	{
+		std::vector<void*> blocks;
+		while (const auto memory = tlsfHeap.allocate(64))
+			blocks.emplace_back(memory);
+		REQUIRE(blocks.size() > sizeof(region.storage) / (64 + 2 * alignment));
+		REQUIRE(tlsfHeap.getStatistics().freeSize < 64 + 2 * alignment);
+
+		for (const auto memory : blocks)
+			tlsfHeap.deallocate(memory);
+		REQUIRE(isEmpty(tlsfHeap) == true);
+	}
+}
+
+TEST_CASE("Testing aligned allocation", "[allocation]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+
+	REQUIRE(tlsfHeap.allocateAligned(0, 1) == nullptr);
+	REQUIRE(tlsfHeap.allocateAligned(alignment * 3, 1) == nullptr);
+
+	// misalign the beginning of free memory
+	const auto guard = tlsfHeap.allocate(1);
+	REQUIRE(guard != nullptr);
+
+	std::vector<void*> blocks;
+	for (size_t blockAlignment {1}; blockAlignment <= 4096; blockAlignment *= 2)
+	{
+		const auto memory = tlsfHeap.allocateAligned(blockAlignment, 10);
+		REQUIRE(memory != nullptr);
+		REQUIRE(reinterpret_cast<uintptr_t>(memory) % blockAlignment == 0);
+		blocks.emplace_back(memory);
+	}
+
+	for (const auto memory : blocks)
+		tlsfHeap.deallocate(memory);
+	tlsfHeap.deallocate(guard);
+	REQUIRE(isEmpty(tlsfHeap) == true);
+}
+
+TEST_CASE("Testing resizing", "[resize]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+
+	const auto memory = tlsfHeap.allocate(1000);
+	REQUIRE(memory != nullptr);
+
+	SECTION("Shrinking must always succeed")
+	{
+		REQUIRE(tlsfHeap.resize(memory, 100) == true);
+		REQUIRE(TlsfHeap::getUsableSize(memory) >= 100);
+		REQUIRE(TlsfHeap::getUsableSize(memory) < 1000);
+		// tail of block must be merged with the rest of the heap
+		REQUIRE(tlsfHeap.getStatistics().freeBlocks == 1);
+	}
+	SECTION("Growing into free block must succeed")
+	{
+		REQUIRE(tlsfHeap.resize(memory, 10000) == true);
+		REQUIRE(TlsfHeap::getUsableSize(memory) >= 10000);
+		REQUIRE(tlsfHeap.getStatistics().usedSize == TlsfHeap::getUsableSize(memory));
+	}
+	SECTION("Growing into allocated block must fail")
+	{
+		const auto guard = tlsfHeap.allocate(1);
+		REQUIRE(guard != nullptr);
+		const auto usableSize = TlsfHeap::getUsableSize(memory);
+		REQUIRE(tlsfHeap.resize(memory, usableSize + 1) == false);
+		REQUIRE(TlsfHeap::getUsableSize(memory) == usableSize);
+		tlsfHeap.deallocate(guard);
+	}
+
+	tlsfHeap.deallocate(memory);
+	REQUIRE(isEmpty(tlsfHeap) == true);
+}
+
+TEST_CASE("Testing statistics", "[statistics]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+
+	const auto memory1 = tlsfHeap.allocate(1000);
+	const auto memory2 = tlsfHeap.allocate(2000);
+	REQUIRE(memory1 != nullptr);
+	REQUIRE(memory2 != nullptr);
+	const auto usedSize = TlsfHeap::getUsableSize(memory1) + TlsfHeap::getUsableSize(memory2);
+	{
+		const auto statistics = tlsfHeap.getStatistics();
+		REQUIRE(statistics.usedSize == usedSize);
+		REQUIRE(statistics.peakUsedSize == usedSize);
+		REQUIRE(statistics.usedBlocks == 2);
+		REQUIRE(statistics.freeSize + statistics.usedSize < statistics.size);
+	}
+
+	tlsfHeap.deallocate(memory1);
+	{
+		const auto statistics = tlsfHeap.getStatistics();
+		REQUIRE(statistics.usedSize == TlsfHeap::getUsableSize(memory2));
+		REQUIRE(statistics.peakUsedSize == usedSize);
+		REQUIRE(statistics.freeBlocks == 2);
+		REQUIRE(statistics.largestFreeSize < statistics.freeSize);
+	}
+
+	tlsfHeap.deallocate(memory2);
+	REQUIRE(isEmpty(tlsfHeap) == true);
+	REQUIRE(tlsfHeap.getStatistics().peakUsedSize == usedSize);
+}
+
+TEST_CASE("Testing pseudo-random sequences", "[random]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+
+	for (const unsigned int seed : {1, 2, 3, 4})
+	{
+		DYNAMIC_SECTION("Seed " << seed)
+		{
+			for (const auto memory : runRandomSequence(tlsfHeap, seed, 10000, 4096))
+				tlsfHeap.deallocate(memory.first);
+			REQUIRE(isEmpty(tlsfHeap) == true);
+		}
+	}
+}
+
+TEST_CASE("Measuring fragmentation", "[benchmark]")
+{
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+
+	const auto blocks = runRandomSequence(tlsfHeap, 5, 100000, 2048);
+	const auto statistics = tlsfHeap.getStatistics();
+	WARN("TlsfHeap after pseudo-random workload: " << statistics.usedBlocks << " used blocks, " <<
+			statistics.usedSize << " used bytes, " << statistics.peakUsedSize << " peak used bytes, " <<
+			statistics.freeBlocks << " free blocks, " << statistics.freeSize << " free bytes, " <<
+			statistics.largestFreeSize << " bytes in the largest free block, fragmentation " <<
+			statistics.fragmentation / 10.0 << " %");
+	REQUIRE(statistics.fragmentation < 1000);
+	// largest free block must be usable
+	const auto memory = tlsfHeap.allocate(statistics.largestFreeSize);
+	REQUIRE(memory != nullptr);
+	tlsfHeap.deallocate(memory);
+
+	for (const auto& block : blocks)
+		tlsfHeap.deallocate(block.first);
+	REQUIRE(isEmpty(tlsfHeap) == true);
+}
+
+TEST_CASE("Comparing performance with malloc() and free()", "[benchmark]")
+{
+	constexpr size_t blockCount {256};
+
+	std::mt19937 generator {6};
+	std::uniform_int_distribution<size_t> sizeDistribution {1, 512};
+	std::vector<size_t> sizes (blockCount);
+	for (auto& size : sizes)
+		size = sizeDistribution(generator);
+	// deallocate in order different than allocation to create holes
+	std::vector<size_t> order (blockCount);
+	for (size_t i {}; i < order.size(); ++i)
+		order[i] = i;
+	std::shuffle(order.begin(), order.end(), generator);
+
+	Region region;
+	TlsfHeap tlsfHeap;
+	REQUIRE(tlsfHeap.initialize(region.storage, sizeof(region.storage)) == true);
+	std::vector<void*> blocks (blockCount);
+
+	BENCHMARK("TlsfHeap, " + std::to_string(blockCount) + " blocks")
+	{
+		for (size_t i {}; i < blockCount; ++i)
+			blocks[i] = tlsfHeap.allocate(sizes[i]);
+		for (const auto i : order)
+			tlsfHeap.deallocate(blocks[i]);
+	};
+	BENCHMARK("malloc(), " + std::to_string(blockCount) + " blocks")
+	{
+		for (size_t i {}; i < blockCount; ++i)
+			blocks[i] = malloc(sizes[i]);
+		for (const auto i : order)
+			free(blocks[i]);
+	};
+
+	REQUIRE(isEmpty(tlsfHeap) == true);
+}
@@ -0,0 +1,122 @@
+/**
+ * \file
+ * \brief TraceBuffer test cases
+ *
+ * This test checks whether TraceBuffer properly stores records, overwrites the oldest records when it is full and
+ * whether its binary layout matches the one expected by the host-side decoder.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "distortos/internal/scheduler/TraceBuffer.hpp"
+
+#include <cstring>
+
+using distortos::internal::TraceBuffer;
+using distortos::internal::TraceEventType;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// capacity of tested trace buffer
+constexpr size_t capacity {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// tested trace buffer
+using TestTraceBuffer = TraceBuffer<capacity>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Reads 32-bit value from binary image of trace buffer.
+ *
+ * \param [in] traceBuffer is a reference to trace buffer
+ * \param [in] offset is the offset of value, bytes
+ *
+ * \return value read from \a offset
+ */
+
+uint32_t read32(const TestTraceBuffer& traceBuffer, const size_t offset)
+{
+	uint32_t value;
+	memcpy(&value, reinterpret_cast<const uint8_t*>(&traceBuffer) + offset, sizeof(value));
+	return value;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing binary layout", "[layout]")
+{
+	TestTraceBuffer traceBuffer;
+
+	REQUIRE(sizeof(traceBuffer) == 20 + capacity * 12);
+	REQUIRE(read32(traceBuffer, 0) == TestTraceBuffer::magic);
+	REQUIRE(memcmp(&traceBuffer, "DTRC", 4) == 0);
+	REQUIRE(read32(traceBuffer, 4) == (TestTraceBuffer::version | 12 << 16));
+	REQUIRE(read32(traceBuffer, 8) == capacity);
+	REQUIRE(read32(traceBuffer, 12) == 0);
+	REQUIRE(read32(traceBuffer, 16) == 0);
+
+	traceBuffer.add(0x12345678, TraceEventType::unblock, 0x20001000, 0x5a);
+	REQUIRE(read32(traceBuffer, 12) == 1);
+	REQUIRE(read32(traceBuffer, 16) == 1);
+	REQUIRE(read32(traceBuffer, 20) == 0x12345678);
+	REQUIRE(read32(traceBuffer, 24) == 0x20001000);
+	REQUIRE(read32(traceBuffer, 28) == (static_cast<uint32_t>(TraceEventType::unblock) | 0x5a << 8));
+}
+
+TEST_CASE("Testing add()", "[add]")
+{
+	TestTraceBuffer traceBuffer;
+	REQUIRE(traceBuffer.getCount() == 0);
+
+	constexpr size_t records {capacity * 2 + 1};
+	for (size_t i {}; i < records; ++i)
+	{
+		traceBuffer.add(i * 100, TraceEventType::userMarker, i, i);
+
+		const auto expectedCount = std::min(i + 1, capacity);
+		REQUIRE(traceBuffer.getCount() == expectedCount);
+		REQUIRE(read32(traceBuffer, 16) == (i + 1) % capacity);
+
+		// the oldest records are overwritten, the order of remaining records is preserved
+		for (size_t j {}; j < expectedCount; ++j)
+		{
+			const auto& record = traceBuffer.getRecord(j);
+			const auto expectedValue = i + 1 - expectedCount + j;
+			REQUIRE(record.timestamp == expectedValue * 100);
+			REQUIRE(record.object == expectedValue);
+			REQUIRE(record.type == static_cast<uint8_t>(TraceEventType::userMarker));
+			REQUIRE(record.argument == expectedValue);
+			REQUIRE(record.reserved == 0);
+		}
+	}
+
+	traceBuffer.reset();
+	REQUIRE(traceBuffer.getCount() == 0);
+	REQUIRE(read32(traceBuffer, 16) == 0);
+
+	traceBuffer.add(1, TraceEventType::contextSwitch, 2, 3);
+	REQUIRE(traceBuffer.getCount() == 1);
+	REQUIRE(traceBuffer.getRecord(0).timestamp == 1);
+	REQUIRE(traceBuffer.getRecord(0).object == 2);
+}
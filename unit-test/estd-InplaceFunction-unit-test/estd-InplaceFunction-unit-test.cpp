@@ -0,0 +1,301 @@
+/**
+ * \file
+ * \brief InplaceFunction test cases
+ *
+ * This test checks whether InplaceFunction properly stores, calls, moves and destroys callable objects.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#include "unit-test-common.hpp"
+
+#include "estd/InplaceFunction.hpp"
+
+#include <memory>
+
+using trompeloeil::_;
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+class FunctorMock
+{
+public:
+
+	FunctorMock()
+	{
+		auto& instance = getInstanceInternal();
+		REQUIRE(instance == nullptr);
+		instance = this;
+	}
+
+	~FunctorMock()
+	{
+		getInstanceInternal() = {};
+	}
+
+	MAKE_MOCK2(constructed, void(const void*, uint32_t));
+	MAKE_MOCK2(copyConstructed, void(const void*, const void*));
+	MAKE_MOCK1(destructed, void(const void*));
+	MAKE_MOCK2(moveConstructed, void(const void*, const void*));
+
+	static FunctorMock& getInstance()
+	{
+		const auto instance = getInstanceInternal();
+		REQUIRE(instance != nullptr);
+		return *instance;
+	}
+
+private:
+
+	static FunctorMock*& getInstanceInternal()
+	{
+		static FunctorMock* instance;
+		return instance;
+	}
+};
+
+class Functor
+{
+public:
+
+	Functor(const uint32_t value) :
+			value_{value}
+	{
+		FunctorMock::getInstance().constructed(this, value);
+	}
+
+	Functor(const Functor& other) :
+			value_{other.value_}
+	{
+		FunctorMock::getInstance().copyConstructed(this, &other);
+	}
+
+	Functor(Functor&& other) :
+			value_(other.value_)
+	{
+		FunctorMock::getInstance().moveConstructed(this, &other);
+	}
+
+	~Functor()
+	{
+		FunctorMock::getInstance().destructed(this);
+	}
+
+	uint32_t operator()(const uint32_t value)
+	{
+		value_ += value;
+		return value_;
+	}
+
+private:
+
+	uint32_t value_;
+};
+
+class Object
+{
+public:
+
+	constexpr explicit Object(const uint32_t value) :
+			value_{value}
+	{
+
+	}
+
+	uint32_t multiply(const uint32_t value) const
+	{
+		return value_ * value;
+	}
+
+private:
+
+	uint32_t value_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of storage used in tests, bytes
+constexpr size_t capacity {sizeof(void*) * 4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+using Function = estd::InplaceFunction<uint32_t(uint32_t), capacity>;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing empty object", "[empty]")
+{
+	const Function function;
+	REQUIRE(static_cast<bool>(function) == false);
+
+	const Function nullFunction {nullptr};
+	REQUIRE(static_cast<bool>(nullFunction) == false);
+}
+
+TEST_CASE("Testing calls", "[call]")
+{
+	SECTION("Capturing lambda")
+	{
+		uint32_t sharedVariable {};
+		Function function {[&sharedVariable](const uint32_t value)
+				{
+					sharedVariable = value;
+					return value + 1;
+				}};
+		REQUIRE(static_cast<bool>(function) == true);
+		REQUIRE(function(0x5326e8d0) == 0x5326e8d1);
+		REQUIRE(sharedVariable == 0x5326e8d0);
+	}
+	SECTION("Regular function")
+	{
+		Function function {[](const uint32_t value)
+				{
+					return ~value;
+				}};
+		REQUIRE(function(0x0ff0f00f) == 0xf00f0ff0);
+	}
+	SECTION("Member function")
+	{
+		const Object object {3};
+		estd::InplaceFunction<uint32_t(const Object&, uint32_t), capacity> function {&Object::multiply};
+		REQUIRE(function(object, 0x10) == 0x30);
+	}
+	SECTION("Move-only callable object")
+	{
+		std::unique_ptr<uint32_t> pointer {new uint32_t{0x1e07bab1}};
+		const auto rawPointer = pointer.get();
+		Function function {[pointer = std::move(pointer)](const uint32_t value)
+				{
+					return *pointer ^ value;
+				}};
+		REQUIRE(function(0x1e07bab1) == 0);
+
+		const auto movedFunction = std::move(function);
+		REQUIRE(static_cast<bool>(function) == false);
+		REQUIRE(movedFunction(0) == *rawPointer);
+	}
+	SECTION("Value returned by callable object is discarded")
+	{
+		uint32_t sharedVariable {};
+		estd::InplaceFunction<void(), capacity> function {[&sharedVariable]()
+				{
+					return ++sharedVariable;
+				}};
+		function();
+		function();
+		REQUIRE(sharedVariable == 2);
+	}
+}
+
+TEST_CASE("Testing lifetime of callable object", "[lifetime]")
+{
+	trompeloeil::sequence sequence {};
+	std::vector<std::unique_ptr<trompeloeil::expectation>> expectations {};
+	FunctorMock functorMock {};
+
+	const void* stored {};
+
+	{
+		const void* temporary {};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, constructed(_, 0x3b0e4bb7u)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(temporary = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, _)).IN_SEQUENCE(sequence)
+				.LR_WITH(_2 == temporary).LR_SIDE_EFFECT(stored = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(_)).IN_SEQUENCE(sequence)
+				.LR_WITH(_1 == temporary));
+		Function function {Functor{0x3b0e4bb7}};
+		expectations.clear();
+		REQUIRE(function(1) == 0x3b0e4bb8);
+		REQUIRE(function(1) == 0x3b0e4bb9);
+
+		const void* moved {};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, stored)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(moved = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(stored)).IN_SEQUENCE(sequence));
+		Function movedFunction {std::move(function)};
+		expectations.clear();
+		REQUIRE(static_cast<bool>(function) == false);
+		// state of callable object is moved too
+		REQUIRE(movedFunction(1) == 0x3b0e4bba);
+
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, moved)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(stored = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(moved)).IN_SEQUENCE(sequence));
+		function = std::move(movedFunction);
+		expectations.clear();
+		REQUIRE(static_cast<bool>(movedFunction) == false);
+		REQUIRE(function(1) == 0x3b0e4bbb);
+
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(stored)).IN_SEQUENCE(sequence));
+		function = nullptr;
+		expectations.clear();
+		REQUIRE(static_cast<bool>(function) == false);
+
+		const void* copied {};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, constructed(_, 0x7d3e1c52u)).IN_SEQUENCE(sequence));
+		const Functor functor {0x7d3e1c52};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, copyConstructed(_, &functor)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(copied = _1));
+		Function copiedFunction {functor};
+		expectations.clear();
+		REQUIRE(copiedFunction(1) == 0x7d3e1c53);
+
+		// callable objects are destroyed in destructors
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(_)).IN_SEQUENCE(sequence)
+				.LR_WITH(_1 == copied));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(&functor)).IN_SEQUENCE(sequence));
+	}
+}
+
+TEST_CASE("Testing move assignment to non-empty object", "[lifetime]")
+{
+	trompeloeil::sequence sequence {};
+	std::vector<std::unique_ptr<trompeloeil::expectation>> expectations {};
+	FunctorMock functorMock {};
+
+	{
+		const void* storedFirst {};
+		const void* storedSecond {};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, constructed(_, 0x4c1a7f30u)).IN_SEQUENCE(sequence));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, _)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(storedFirst = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(_)).IN_SEQUENCE(sequence));
+		Function function {Functor{0x4c1a7f30}};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, constructed(_, 0x91e5b2d4u)).IN_SEQUENCE(sequence));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, _)).IN_SEQUENCE(sequence)
+				.LR_SIDE_EFFECT(storedSecond = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(_)).IN_SEQUENCE(sequence));
+		Function otherFunction {Functor{0x91e5b2d4}};
+		expectations.clear();
+
+		// callable object contained in assigned object is destroyed before callable object from the source is moved
+		const void* moved {};
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(storedFirst)).IN_SEQUENCE(sequence));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, moveConstructed(_, storedSecond))
+				.IN_SEQUENCE(sequence).LR_SIDE_EFFECT(moved = _1));
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(storedSecond)).IN_SEQUENCE(sequence));
+		function = std::move(otherFunction);
+		expectations.clear();
+		REQUIRE(static_cast<bool>(otherFunction) == false);
+		REQUIRE(function(1) == 0x91e5b2d5);
+
+		expectations.emplace_back(NAMED_REQUIRE_CALL(functorMock, destructed(moved)).IN_SEQUENCE(sequence));
+	}
+}
@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of Mutex class
  *
- * \author Copyright (C) 2017-2019 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ * \author Copyright (C) 2017-2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "unit-test-common.hpp"
 
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
 #include "distortos/MutexProtocol.hpp"
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
@@ -80,6 +82,9 @@ public:
 	}
 
 	MAKE_MOCK3(construct, void(Type, Protocol, uint8_t));
+	MAKE_MOCK1(doRequeue, void(distortos::internal::ThreadList::iterator));
+	MAKE_CONST_MOCK0(getOwner, distortos::internal::ThreadControlBlock*());
+	MAKE_CONST_MOCK0(getProtocol, Protocol());
 	MAKE_MOCK0(lock, int());
 	MAKE_MOCK0(tryLock, int());
 	MAKE_MOCK1(tryLockFor, int(TickClock::duration));
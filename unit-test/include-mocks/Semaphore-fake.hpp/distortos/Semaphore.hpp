@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief Fake of Semaphore class
+ *
+ * Unlike the mock, this fake is a real counting semaphore which may be used by several host threads. Timeouts are not
+ * supported - tryWaitUntil() doesn't block.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_SEMAPHORE_FAKE_HPP_DISTORTOS_SEMAPHORE_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_SEMAPHORE_FAKE_HPP_DISTORTOS_SEMAPHORE_HPP_
+
+#include "distortos/TickClock.hpp"
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+
+namespace distortos
+{
+
+class Semaphore
+{
+public:
+
+	using Value = unsigned int;
+
+	explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
+			conditionVariable_{},
+			mutex_{},
+			maxValue_{maxValue},
+			value_{value <= maxValue ? value : maxValue}
+	{
+
+	}
+
+	Value getMaxValue() const
+	{
+		return maxValue_;
+	}
+
+	Value getValue() const
+	{
+		const std::lock_guard<std::mutex> lock {mutex_};
+		return value_;
+	}
+
+	int post()
+	{
+		{
+			const std::lock_guard<std::mutex> lock {mutex_};
+			if (value_ == maxValue_)
+				return EOVERFLOW;
+
+			++value_;
+		}
+
+		conditionVariable_.notify_one();
+		return 0;
+	}
+
+	int tryWait()
+	{
+		const std::lock_guard<std::mutex> lock {mutex_};
+		if (value_ == 0)
+			return EAGAIN;
+
+		--value_;
+		return 0;
+	}
+
+	int tryWaitUntil(TickClock::time_point)
+	{
+		return tryWait() == 0 ? 0 : ETIMEDOUT;
+	}
+
+	int wait()
+	{
+		std::unique_lock<std::mutex> lock {mutex_};
+		conditionVariable_.wait(lock, [this]() { return value_ != 0; });
+		--value_;
+		return 0;
+	}
+
+private:
+
+	std::condition_variable conditionVariable_;
+	mutable std::mutex mutex_;
+	const Value maxValue_;
+	Value value_;
+};
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_SEMAPHORE_FAKE_HPP_DISTORTOS_SEMAPHORE_HPP_
@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief Mock of getCycleCount()
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETCYCLECOUNT_HPP_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETCYCLECOUNT_HPP_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+
+#include "unit-test-common.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+class GetCycleCountMock
+{
+public:
+
+	GetCycleCountMock()
+	{
+		auto& instance = getInstanceInternal();
+		REQUIRE(instance == nullptr);
+		instance = this;
+	}
+
+	~GetCycleCountMock()
+	{
+		auto& instance = getInstanceInternal();
+		REQUIRE(instance != nullptr);
+		instance = {};
+	}
+
+	MAKE_CONST_MOCK0(getCycleCount, uint32_t());
+
+	static const GetCycleCountMock& getInstance()
+	{
+		const auto instance = getInstanceInternal();
+		REQUIRE(instance != nullptr);
+		return *instance;
+	}
+
+private:
+
+	static const GetCycleCountMock*& getInstanceInternal()
+	{
+		static const GetCycleCountMock* instance;
+		return instance;
+	}
+};
+
+inline uint32_t getCycleCount()
+{
+	return GetCycleCountMock::getInstance().getCycleCount();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_ARCHITECTURE_GETCYCLECOUNT_HPP_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
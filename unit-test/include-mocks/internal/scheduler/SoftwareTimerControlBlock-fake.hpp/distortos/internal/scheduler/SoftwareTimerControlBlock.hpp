@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief Fake of SoftwareTimerControlBlock class
+ *
+ * This fake uses real SoftwareTimerListNode, so it can be linked in real lists of software timers.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
+
+#include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SoftwareTimerControlBlock : public SoftwareTimerListNode
+{
+public:
+
+	void setTimePoint(const TickClock::time_point timePoint)
+	{
+		SoftwareTimerListNode::setTimePoint(timePoint);
+	}
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief Fake of ThreadControlBlock class
+ *
+ * Unlike the mock, this fake uses real ThreadListNode, so it can be linked in real thread lists.
+ *
+ * \author Copyright (C) 2026 Kamil Szczygiel https://distortec.com https://freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_HPP_
+
+#include "distortos/internal/scheduler/ThreadListNode.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock : public ThreadListNode
+{
+public:
+
+	constexpr explicit ThreadControlBlock(const uint8_t priority) :
+			ThreadListNode{priority}
+	{
+
+	}
+
+#if DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	void setDeadline(const TickClock::time_point deadline)
+	{
+		deadline_ = deadline;
+	}
+
+#endif	// DISTORTOS_SCHEDULER_DEADLINE_ENABLE == 1
+
+	void setPriority(const uint8_t priority)
+	{
+		priority_ = priority;
+	}
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_FAKE_HPP_DISTORTOS_INTERNAL_SCHEDULER_THREADCONTROLBLOCK_HPP_